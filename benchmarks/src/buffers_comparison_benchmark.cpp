@@ -1,13 +1,27 @@
 #include <benchmark/benchmark.h>
 
 #include <csvreader/csvreader.hpp>
+#include <csvreader/csvparallelreader.hpp>
+#include <csvreader/csvpipelinedreader.hpp>
 #include <csvconfig.hpp>
+#include <csvbuffer/csvpipebuffer.hpp>
+#include <csvbuffer/csvstreambuffer.hpp>
 
 #include <testdata.hpp>
 #include <helpers.hpp>
 #include <sstream>
 #include <string>
 
+#include <thread>
+
+#include <fcntl.h>
+#include <unistd.h>
+#include <sys/resource.h>
+
+#ifdef CSVENGINE_HAS_ZLIB
+#include <zlib.h>
+#endif
+
 namespace csv {
 
 constexpr int64_t small_data  = 100;
@@ -36,9 +50,32 @@ public:
 
     void TearDown(const ::benchmark::State& state) override {
         std::remove(filename_.c_str());
+        std::remove(gzip_filename().c_str());
+    }
+
+    std::string gzip_filename() const {
+        return filename_ + ".gz";
     }
 
     void benchmark_body(benchmark::State& state, Config cfg) {
+        benchmark_body(state, cfg, filename_);
+    }
+
+    // drops the file from the page cache before every iteration, so the reads come from the disk
+    void cold_cache_body(benchmark::State& state, Config cfg) {
+        benchmark_body(state, cfg, filename_, true);
+    }
+
+    static void evict_from_page_cache(const std::string& filename) {
+        int fd = open(filename.c_str(), O_RDONLY | O_CLOEXEC);
+        if (fd >= 0) {
+            fdatasync(fd);
+            posix_fadvise(fd, 0, 0, POSIX_FADV_DONTNEED);
+            close(fd);
+        }
+    }
+
+    void benchmark_body(benchmark::State& state, Config cfg, const std::string& filename, bool cold_cache = false) {
         cfg.streaming = true;
         cfg.has_header = true;
         cfg.has_quoting = true;
@@ -46,9 +83,17 @@ public:
         cfg.line_ending = Config::LineEnding::lf;
 
         std::size_t total_rows = 0;
+        rusage usage_before{};
+        getrusage(RUSAGE_SELF, &usage_before);
 
         for (auto _ : state) {
-            Reader reader(filename_, cfg);
+            if (cold_cache) {
+                state.PauseTiming();
+                evict_from_page_cache(filename);
+                state.ResumeTiming();
+            }
+
+            Reader reader(filename, cfg);
 
             while (reader.next()) {
                 const auto& rec = reader.current_record();
@@ -59,9 +104,77 @@ public:
             benchmark::DoNotOptimize(total_rows);
         }
 
+        rusage usage_after{};
+        getrusage(RUSAGE_SELF, &usage_after);
+
+        // page faults per iteration, major ones waited for the disk
+        state.counters["major_faults"] = benchmark::Counter(
+            static_cast<double>(usage_after.ru_majflt - usage_before.ru_majflt), benchmark::Counter::kAvgIterations);
+        state.counters["minor_faults"] = benchmark::Counter(
+            static_cast<double>(usage_after.ru_minflt - usage_before.ru_minflt), benchmark::Counter::kAvgIterations);
+
+        state.SetItemsProcessed(static_cast<int64_t>(total_rows));
+        state.SetBytesProcessed(static_cast<int64_t>(state.iterations()) * csv_file_content_.size());
+    }
+
+    // ViewReader over the whole mapped file, or ParallelReader with state.range(1) threads
+    template <typename MakeReader>
+    void view_reader_body(benchmark::State& state, MakeReader make_reader) {
+        std::size_t total_rows = 0;
+
+        for (auto _ : state) {
+            auto reader = make_reader();
+
+            while (reader->next()) {
+                const auto& rec = reader->current_record();
+                total_rows++;
+                benchmark::DoNotOptimize(rec);
+            }
+
+            benchmark::DoNotOptimize(total_rows);
+        }
+
+        state.SetItemsProcessed(static_cast<int64_t>(total_rows));
+        state.SetBytesProcessed(static_cast<int64_t>(state.iterations()) * csv_file_content_.size());
+    }
+
+#ifdef CSVENGINE_HAS_ZLIB
+    void write_gzip_file() {
+        gzFile out = gzopen(gzip_filename().c_str(), "wb6");
+        gzwrite(out, csv_file_content_.data(), static_cast<unsigned>(csv_file_content_.size()));
+        gzclose(out);
+    }
+
+    // what DecompressingBuffer replaces: inflate to a temporary file, then parse that file
+    void gunzip_to_file_body(benchmark::State& state) {
+        write_gzip_file();
+        const std::string inflated = filename_ + ".inflated";
+        std::size_t total_rows = 0;
+
+        for (auto _ : state) {
+            {
+                gzFile in = gzopen(gzip_filename().c_str(), "rb");
+                std::ofstream out(inflated, std::ios::binary);
+                char chunk[64 * 1024];
+                int bytes;
+                while ((bytes = gzread(in, chunk, sizeof(chunk))) > 0) {
+                    out.write(chunk, bytes);
+                }
+                gzclose(in);
+            }
+
+            Reader reader(inflated, Config{});
+            while (reader.next()) {
+                total_rows++;
+                benchmark::DoNotOptimize(reader.current_record());
+            }
+        }
+
+        std::remove(inflated.c_str());
         state.SetItemsProcessed(static_cast<int64_t>(total_rows));
         state.SetBytesProcessed(static_cast<int64_t>(state.iterations()) * csv_file_content_.size());
     }
+#endif
 };
 
 class BuffersComparisonSimpleDataFixture : public BuffersComparisonFixture {
@@ -76,7 +189,7 @@ public:
 
 BENCHMARK_DEFINE_F(BuffersComparisonSimpleDataFixture, StreamBuffer_Simple)(benchmark::State& state) {
     Config cfg {
-        .mapped_buffer = false,
+        .buffer_kind = Config::BufferKind::stream,
     };
 
     benchmark_body(state, cfg);
@@ -84,7 +197,7 @@ BENCHMARK_DEFINE_F(BuffersComparisonSimpleDataFixture, StreamBuffer_Simple)(benc
 
 BENCHMARK_DEFINE_F(BuffersComparisonSimpleDataFixture, MappedBuffer_Simple)(benchmark::State& state) {
     Config cfg {
-        .mapped_buffer = true,
+        .buffer_kind = Config::BufferKind::mapped,
     };
 
     benchmark_body(state, cfg);
@@ -92,19 +205,316 @@ BENCHMARK_DEFINE_F(BuffersComparisonSimpleDataFixture, MappedBuffer_Simple)(benc
 
 BENCHMARK_DEFINE_F(BuffersComparisonQuotedDataFixture, StreamBuffer_Quoted)(benchmark::State& state) {
     Config cfg {
-        .mapped_buffer = false,
+        .buffer_kind = Config::BufferKind::stream,
     };
 
     benchmark_body(state, cfg);
 }
 BENCHMARK_DEFINE_F(BuffersComparisonQuotedDataFixture, MappedBuffer_Quoted)(benchmark::State& state) {
     Config cfg {
-        .mapped_buffer = true,
+        .buffer_kind = Config::BufferKind::mapped,
     };
 
     benchmark_body(state, cfg);   
 }
 
+BENCHMARK_DEFINE_F(BuffersComparisonSimpleDataFixture, UringBuffer_Simple)(benchmark::State& state) {
+    Config cfg {
+        .buffer_kind = Config::BufferKind::uring,
+    };
+
+    benchmark_body(state, cfg);
+}
+
+BENCHMARK_DEFINE_F(BuffersComparisonQuotedDataFixture, UringBuffer_Quoted)(benchmark::State& state) {
+    Config cfg {
+        .buffer_kind = Config::BufferKind::uring,
+    };
+
+    benchmark_body(state, cfg);
+}
+
+BENCHMARK_DEFINE_F(BuffersComparisonSimpleDataFixture, ReadAheadBuffer_Simple)(benchmark::State& state) {
+    Config cfg {
+        .read_ahead = true,
+    };
+
+    benchmark_body(state, cfg);
+}
+
+BENCHMARK_DEFINE_F(BuffersComparisonQuotedDataFixture, ReadAheadBuffer_Quoted)(benchmark::State& state) {
+    Config cfg {
+        .read_ahead = true,
+    };
+
+    benchmark_body(state, cfg);
+}
+
+BENCHMARK_DEFINE_F(BuffersComparisonSimpleDataFixture, FdBuffer_Simple)(benchmark::State& state) {
+    Config cfg {
+        .buffer_kind = Config::BufferKind::fd,
+    };
+
+    benchmark_body(state, cfg);
+}
+
+BENCHMARK_DEFINE_F(BuffersComparisonQuotedDataFixture, FdBuffer_Quoted)(benchmark::State& state) {
+    Config cfg {
+        .buffer_kind = Config::BufferKind::fd,
+    };
+
+    benchmark_body(state, cfg);
+}
+
+BENCHMARK_DEFINE_F(BuffersComparisonSimpleDataFixture, DirectIoBuffer_Simple)(benchmark::State& state) {
+    Config cfg {
+        .buffer_kind = Config::BufferKind::direct_io,
+    };
+
+    benchmark_body(state, cfg);
+}
+
+BENCHMARK_DEFINE_F(BuffersComparisonQuotedDataFixture, DirectIoBuffer_Quoted)(benchmark::State& state) {
+    Config cfg {
+        .buffer_kind = Config::BufferKind::direct_io,
+    };
+
+    benchmark_body(state, cfg);
+}
+
+BENCHMARK_DEFINE_F(BuffersComparisonSimpleDataFixture, MappedWindowBuffer_Simple)(benchmark::State& state) {
+    Config cfg {
+        .buffer_kind = Config::BufferKind::mapped,
+        .mapped_window = 1024 * 1024,
+    };
+
+    benchmark_body(state, cfg);
+}
+
+BENCHMARK_DEFINE_F(BuffersComparisonQuotedDataFixture, MappedWindowBuffer_Quoted)(benchmark::State& state) {
+    Config cfg {
+        .buffer_kind = Config::BufferKind::mapped,
+        .mapped_window = 1024 * 1024,
+    };
+
+    benchmark_body(state, cfg);
+}
+
+BENCHMARK_DEFINE_F(BuffersComparisonSimpleDataFixture, StreamBuffer_ColdCache_Simple)(benchmark::State& state) {
+    cold_cache_body(state, Config{});
+}
+
+// the I/O thread waits for the disk while the parser works on the previous block
+BENCHMARK_DEFINE_F(BuffersComparisonSimpleDataFixture, ReadAheadBuffer_ColdCache_Simple)(benchmark::State& state) {
+    Config cfg {
+        .read_ahead = true,
+    };
+
+    cold_cache_body(state, cfg);
+}
+
+BENCHMARK_DEFINE_F(BuffersComparisonSimpleDataFixture, MappedBuffer_ColdCache_Simple)(benchmark::State& state) {
+    Config cfg {
+        .buffer_kind = Config::BufferKind::mapped,
+    };
+
+    cold_cache_body(state, cfg);
+}
+
+BENCHMARK_DEFINE_F(BuffersComparisonSimpleDataFixture, MappedPopulate_ColdCache_Simple)(benchmark::State& state) {
+    Config cfg {
+        .buffer_kind = Config::BufferKind::mapped,
+        .mapped_populate = true,
+    };
+
+    cold_cache_body(state, cfg);
+}
+
+BENCHMARK_DEFINE_F(BuffersComparisonSimpleDataFixture, MappedHugePages_ColdCache_Simple)(benchmark::State& state) {
+    Config cfg {
+        .buffer_kind = Config::BufferKind::mapped,
+        .mapped_huge_pages = true,
+    };
+
+    cold_cache_body(state, cfg);
+}
+
+BENCHMARK_DEFINE_F(BuffersComparisonSimpleDataFixture, MappedPrefetch_ColdCache_Simple)(benchmark::State& state) {
+    Config cfg {
+        .buffer_kind = Config::BufferKind::mapped,
+        .mapped_prefetch = 8 * 1024 * 1024,
+    };
+
+    cold_cache_body(state, cfg);
+}
+
+BENCHMARK_DEFINE_F(BuffersComparisonSimpleDataFixture, ViewReaderMapped_Simple)(benchmark::State& state) {
+    view_reader_body(state, [this] {
+        return std::make_unique<ViewReader>(filename_, Config{.buffer_kind = Config::BufferKind::mapped});
+    });
+}
+
+BENCHMARK_DEFINE_F(BuffersComparisonSimpleDataFixture, ParallelReader_Simple)(benchmark::State& state) {
+    const auto threads = static_cast<size_t>(state.range(1));
+    view_reader_body(state, [this, threads] {
+        return std::make_unique<ParallelReader>(filename_, Config{}, threads);
+    });
+}
+
+BENCHMARK_DEFINE_F(BuffersComparisonQuotedDataFixture, ViewReaderMapped_Quoted)(benchmark::State& state) {
+    view_reader_body(state, [this] {
+        return std::make_unique<ViewReader>(filename_, Config{.buffer_kind = Config::BufferKind::mapped});
+    });
+}
+
+// chunk boundaries fall inside quoted fields, the quote counting pass realigns them
+BENCHMARK_DEFINE_F(BuffersComparisonQuotedDataFixture, ParallelReader_Quoted)(benchmark::State& state) {
+    const auto threads = static_cast<size_t>(state.range(1));
+    view_reader_body(state, [this, threads] {
+        return std::make_unique<ParallelReader>(filename_, Config{}, threads);
+    });
+}
+
+BENCHMARK_DEFINE_F(BuffersComparisonSimpleDataFixture, PipelinedReader_Simple)(benchmark::State& state) {
+    view_reader_body(state, [this] {
+        return std::make_unique<PipelinedReader>(filename_);
+    });
+}
+
+// state.range(1) ParallelReaders of the same file read at once, each from its own thread, with the
+// parsing tasks on the shared default executor or on one pool per reader (a reader owning its threads)
+template <typename MakeReader>
+static void concurrent_readers(benchmark::State& state, size_t file_size, MakeReader make_reader) {
+    const auto readers = static_cast<size_t>(state.range(1));
+
+    for (auto _ : state) {
+        std::vector<std::thread> threads;
+        for (size_t r = 0; r < readers; r++) {
+            threads.emplace_back([&make_reader] {
+                auto reader = make_reader();
+                size_t rows = 0;
+                while (reader->next()) {
+                    rows++;
+                }
+                benchmark::DoNotOptimize(rows);
+            });
+        }
+        for (auto& thread : threads) {
+            thread.join();
+        }
+    }
+
+    state.SetBytesProcessed(static_cast<int64_t>(state.iterations() * readers * file_size));
+}
+
+BENCHMARK_DEFINE_F(BuffersComparisonSimpleDataFixture, ConcurrentParallelReaders_SharedExecutor)(benchmark::State& state) {
+    concurrent_readers(state, csv_file_content_.size(), [this] {
+        return std::make_unique<ParallelReader>(filename_);
+    });
+}
+
+BENCHMARK_DEFINE_F(BuffersComparisonSimpleDataFixture, ConcurrentParallelReaders_OwnExecutors)(benchmark::State& state) {
+    struct OwningReader {
+        WorkStealingExecutor executor;
+        ParallelReader reader;
+        explicit OwningReader(const std::string& filename) : reader(filename, {}, 0, ParallelReader::DEFAULT_CHUNK_SIZE, executor) {}
+        bool next() { return reader.next(); }
+    };
+    concurrent_readers(state, csv_file_content_.size(), [this] {
+        return std::make_unique<OwningReader>(filename_);
+    });
+}
+
+#ifdef CSVENGINE_HAS_ZLIB
+BENCHMARK_DEFINE_F(BuffersComparisonSimpleDataFixture, GzipBuffer_Simple)(benchmark::State& state) {
+    write_gzip_file();
+    benchmark_body(state, Config{}, gzip_filename());
+}
+
+BENCHMARK_DEFINE_F(BuffersComparisonQuotedDataFixture, GzipBuffer_Quoted)(benchmark::State& state) {
+    write_gzip_file();
+    benchmark_body(state, Config{}, gzip_filename());
+}
+
+BENCHMARK_DEFINE_F(BuffersComparisonSimpleDataFixture, GzipReadAheadBuffer_Simple)(benchmark::State& state) {
+    write_gzip_file();
+    benchmark_body(state, Config{.read_ahead = true}, gzip_filename());
+}
+
+BENCHMARK_DEFINE_F(BuffersComparisonSimpleDataFixture, PipelinedGzip_Simple)(benchmark::State& state) {
+    write_gzip_file();
+    view_reader_body(state, [this] {
+        return std::make_unique<PipelinedReader>(gzip_filename());
+    });
+}
+
+BENCHMARK_DEFINE_F(BuffersComparisonSimpleDataFixture, GunzipToFileThenRead_Simple)(benchmark::State& state) {
+    gunzip_to_file_body(state);
+}
+#endif
+
+// CSV fed through a pipe by a producer thread, read by StreamBuffer (ifstream on /dev/fd) or PipeBuffer
+template <typename ReaderType = ViewReader, typename MakeBuffer>
+static void read_from_pipe(benchmark::State& state, MakeBuffer make_buffer) {
+    const std::string csv_text = repeat_csv(simple_csv_data, static_cast<int>(state.range(0)));
+    std::size_t total_rows = 0;
+
+    for (auto _ : state) {
+        int fds[2];
+        if (pipe2(fds, O_CLOEXEC) != 0) {
+            state.SkipWithError("pipe2 failed");
+            return;
+        }
+
+        std::thread producer([&] {
+            size_t written = 0;
+            while (written < csv_text.size()) {
+                ssize_t bytes = write(fds[1], csv_text.data() + written, csv_text.size() - written);
+                if (bytes <= 0) break;
+                written += static_cast<size_t>(bytes);
+            }
+            close(fds[1]);
+        });
+
+        {
+            ReaderType reader(make_buffer(fds[0]), Config{});
+            while (reader.next()) {
+                total_rows++;
+                benchmark::DoNotOptimize(reader.current_record());
+            }
+        }
+
+        producer.join();
+        close(fds[0]);
+    }
+
+    state.SetItemsProcessed(static_cast<int64_t>(total_rows));
+    state.SetBytesProcessed(static_cast<int64_t>(state.iterations()) * csv_text.size());
+}
+
+static void BM_StreamBuffer_Pipe(benchmark::State& state) {
+    read_from_pipe(state, [](int fd) { return make_stream_buffer("/dev/fd/" + std::to_string(fd)); });
+}
+
+static void BM_PipeBuffer_Pipe(benchmark::State& state) {
+    read_from_pipe(state, [](int fd) { return make_pipe_buffer(fd); });
+}
+
+static void BM_PipelinedReader_Pipe(benchmark::State& state) {
+    read_from_pipe<PipelinedReader>(state, [](int fd) { return make_pipe_buffer(fd); });
+}
+
+static void BM_PipeBuffer_DefaultPipeSize(benchmark::State& state) {
+    read_from_pipe(state, [](int fd) -> std::unique_ptr<IBuffer> {
+        return std::make_unique<PipeBuffer>(fd, PipeBuffer::DEFAULT_CAPACITY, 0);
+    });
+}
+
+BENCHMARK(BM_StreamBuffer_Pipe)->Arg(big_data)->Arg(huge_data);
+BENCHMARK(BM_PipeBuffer_Pipe)->Arg(big_data)->Arg(huge_data);
+BENCHMARK(BM_PipeBuffer_DefaultPipeSize)->Arg(huge_data);
+BENCHMARK(BM_PipelinedReader_Pipe)->Arg(big_data)->Arg(huge_data)->UseRealTime();
+
 BENCHMARK_REGISTER_F(BuffersComparisonSimpleDataFixture, StreamBuffer_Simple)->Arg(small_data);
 BENCHMARK_REGISTER_F(BuffersComparisonSimpleDataFixture, MappedBuffer_Simple)->Arg(small_data);
 BENCHMARK_REGISTER_F(BuffersComparisonSimpleDataFixture, StreamBuffer_Simple)->Arg(medium_data);
@@ -113,6 +523,34 @@ BENCHMARK_REGISTER_F(BuffersComparisonSimpleDataFixture, StreamBuffer_Simple)->A
 BENCHMARK_REGISTER_F(BuffersComparisonSimpleDataFixture, MappedBuffer_Simple)->Arg(big_data);
 BENCHMARK_REGISTER_F(BuffersComparisonSimpleDataFixture, StreamBuffer_Simple)->Arg(huge_data);
 BENCHMARK_REGISTER_F(BuffersComparisonSimpleDataFixture, MappedBuffer_Simple)->Arg(huge_data);
+BENCHMARK_REGISTER_F(BuffersComparisonSimpleDataFixture, MappedWindowBuffer_Simple)->Arg(big_data);
+BENCHMARK_REGISTER_F(BuffersComparisonSimpleDataFixture, MappedWindowBuffer_Simple)->Arg(huge_data);
+BENCHMARK_REGISTER_F(BuffersComparisonSimpleDataFixture, UringBuffer_Simple)->Arg(big_data);
+BENCHMARK_REGISTER_F(BuffersComparisonSimpleDataFixture, UringBuffer_Simple)->Arg(huge_data);
+BENCHMARK_REGISTER_F(BuffersComparisonSimpleDataFixture, ReadAheadBuffer_Simple)->Arg(big_data);
+BENCHMARK_REGISTER_F(BuffersComparisonSimpleDataFixture, ReadAheadBuffer_Simple)->Arg(huge_data);
+BENCHMARK_REGISTER_F(BuffersComparisonSimpleDataFixture, FdBuffer_Simple)->Arg(big_data);
+BENCHMARK_REGISTER_F(BuffersComparisonSimpleDataFixture, FdBuffer_Simple)->Arg(huge_data);
+BENCHMARK_REGISTER_F(BuffersComparisonSimpleDataFixture, DirectIoBuffer_Simple)->Arg(big_data);
+BENCHMARK_REGISTER_F(BuffersComparisonSimpleDataFixture, DirectIoBuffer_Simple)->Arg(huge_data);
+BENCHMARK_REGISTER_F(BuffersComparisonSimpleDataFixture, StreamBuffer_ColdCache_Simple)->Arg(huge_data);
+BENCHMARK_REGISTER_F(BuffersComparisonSimpleDataFixture, ReadAheadBuffer_ColdCache_Simple)->Arg(huge_data);
+BENCHMARK_REGISTER_F(BuffersComparisonSimpleDataFixture, MappedBuffer_ColdCache_Simple)->Arg(huge_data);
+BENCHMARK_REGISTER_F(BuffersComparisonSimpleDataFixture, MappedPopulate_ColdCache_Simple)->Arg(huge_data);
+BENCHMARK_REGISTER_F(BuffersComparisonSimpleDataFixture, MappedHugePages_ColdCache_Simple)->Arg(huge_data);
+BENCHMARK_REGISTER_F(BuffersComparisonSimpleDataFixture, MappedPrefetch_ColdCache_Simple)->Arg(huge_data);
+BENCHMARK_REGISTER_F(BuffersComparisonSimpleDataFixture, ViewReaderMapped_Simple)->Arg(huge_data)->UseRealTime();
+BENCHMARK_REGISTER_F(BuffersComparisonSimpleDataFixture, PipelinedReader_Simple)->Arg(huge_data)->UseRealTime();
+BENCHMARK_REGISTER_F(BuffersComparisonSimpleDataFixture, ConcurrentParallelReaders_SharedExecutor)->Args({big_data * 10, 4})->UseRealTime();
+BENCHMARK_REGISTER_F(BuffersComparisonSimpleDataFixture, ConcurrentParallelReaders_OwnExecutors)->Args({big_data * 10, 4})->UseRealTime();
+BENCHMARK_REGISTER_F(BuffersComparisonSimpleDataFixture, ParallelReader_Simple)->Args({huge_data, 1})->Args({huge_data, 2})->Args({huge_data, 4})->UseRealTime();
+#ifdef CSVENGINE_HAS_ZLIB
+BENCHMARK_REGISTER_F(BuffersComparisonSimpleDataFixture, GzipBuffer_Simple)->Arg(big_data);
+BENCHMARK_REGISTER_F(BuffersComparisonSimpleDataFixture, GzipBuffer_Simple)->Arg(huge_data);
+BENCHMARK_REGISTER_F(BuffersComparisonSimpleDataFixture, GzipReadAheadBuffer_Simple)->Arg(huge_data);
+BENCHMARK_REGISTER_F(BuffersComparisonSimpleDataFixture, GunzipToFileThenRead_Simple)->Arg(huge_data);
+BENCHMARK_REGISTER_F(BuffersComparisonSimpleDataFixture, PipelinedGzip_Simple)->Arg(huge_data)->UseRealTime();
+#endif
 
 BENCHMARK_REGISTER_F(BuffersComparisonQuotedDataFixture, StreamBuffer_Quoted)->Arg(small_data);
 BENCHMARK_REGISTER_F(BuffersComparisonQuotedDataFixture, MappedBuffer_Quoted)->Arg(small_data);
@@ -122,4 +560,20 @@ BENCHMARK_REGISTER_F(BuffersComparisonQuotedDataFixture, StreamBuffer_Quoted)->A
 BENCHMARK_REGISTER_F(BuffersComparisonQuotedDataFixture, MappedBuffer_Quoted)->Arg(big_data);
 BENCHMARK_REGISTER_F(BuffersComparisonQuotedDataFixture, StreamBuffer_Quoted)->Arg(huge_data);
 BENCHMARK_REGISTER_F(BuffersComparisonQuotedDataFixture, MappedBuffer_Quoted)->Arg(huge_data);
+BENCHMARK_REGISTER_F(BuffersComparisonQuotedDataFixture, MappedWindowBuffer_Quoted)->Arg(big_data);
+BENCHMARK_REGISTER_F(BuffersComparisonQuotedDataFixture, MappedWindowBuffer_Quoted)->Arg(huge_data);
+BENCHMARK_REGISTER_F(BuffersComparisonQuotedDataFixture, UringBuffer_Quoted)->Arg(big_data);
+BENCHMARK_REGISTER_F(BuffersComparisonQuotedDataFixture, UringBuffer_Quoted)->Arg(huge_data);
+BENCHMARK_REGISTER_F(BuffersComparisonQuotedDataFixture, ReadAheadBuffer_Quoted)->Arg(big_data);
+BENCHMARK_REGISTER_F(BuffersComparisonQuotedDataFixture, ReadAheadBuffer_Quoted)->Arg(huge_data);
+BENCHMARK_REGISTER_F(BuffersComparisonQuotedDataFixture, FdBuffer_Quoted)->Arg(big_data);
+BENCHMARK_REGISTER_F(BuffersComparisonQuotedDataFixture, FdBuffer_Quoted)->Arg(huge_data);
+BENCHMARK_REGISTER_F(BuffersComparisonQuotedDataFixture, DirectIoBuffer_Quoted)->Arg(big_data);
+BENCHMARK_REGISTER_F(BuffersComparisonQuotedDataFixture, DirectIoBuffer_Quoted)->Arg(huge_data);
+BENCHMARK_REGISTER_F(BuffersComparisonQuotedDataFixture, ViewReaderMapped_Quoted)->Arg(huge_data)->UseRealTime();
+BENCHMARK_REGISTER_F(BuffersComparisonQuotedDataFixture, ParallelReader_Quoted)->Args({huge_data, 1})->Args({huge_data, 4})->UseRealTime();
+#ifdef CSVENGINE_HAS_ZLIB
+BENCHMARK_REGISTER_F(BuffersComparisonQuotedDataFixture, GzipBuffer_Quoted)->Arg(big_data);
+BENCHMARK_REGISTER_F(BuffersComparisonQuotedDataFixture, GzipBuffer_Quoted)->Arg(huge_data);
+#endif
 }
\ No newline at end of file
@@ -1,6 +1,7 @@
 #include <benchmark/benchmark.h>
 
 #include <csvreader/csvreader.hpp>
+#include <csvreader/csvdialectreader.hpp>
 #include <csvconfig.hpp>
 
 #include <testdata.hpp>
@@ -13,6 +14,7 @@ constexpr int64_t small_data  = 100;
 constexpr int64_t medium_data = 1000;
 constexpr int64_t big_data    = 10000;
 
+template <typename R = Reader>
 static void BM_ParserComparison_TestBody(benchmark::State& state, Config& cfg, const std::string& data) {
     const int repeats = static_cast<int>(state.range(0));
     const std::string csv_text = repeat_csv(data, repeats);
@@ -21,7 +23,7 @@ static void BM_ParserComparison_TestBody(benchmark::State& state, Config& cfg, c
 
     for (auto _ : state) {
         auto stream = std::make_unique<std::istringstream>(csv_text);
-        Reader reader(std::move(stream), cfg);
+        R reader(std::move(stream), cfg);
 
         int64_t rows = 0;
         while (reader.next()) {
@@ -47,6 +49,24 @@ static void BM_SimpleData_ParserComparison_SimpleParser(benchmark::State& state)
     };
     BM_ParserComparison_TestBody(state, cfg, simple_csv_data);
 }
+static void BM_SimpleData_ParserComparison_SimdParser(benchmark::State& state) {
+    Config cfg{
+        .has_header = true,
+        .has_quoting = false,
+        .line_ending = Config::LineEnding::lf,
+        .kernel = Config::Kernel::avx2,
+    };
+    BM_ParserComparison_TestBody(state, cfg, simple_csv_data);
+}
+static void BM_SimpleData_ParserComparison_SwarParser(benchmark::State& state) {
+    Config cfg{
+        .has_header = true,
+        .has_quoting = false,
+        .line_ending = Config::LineEnding::lf,
+        .kernel = Config::Kernel::swar,
+    };
+    BM_ParserComparison_TestBody(state, cfg, simple_csv_data);
+}
 static void BM_SimpleData_ParserComparison_StrictParser(benchmark::State& state) {
     Config cfg{
         .has_header = true,
@@ -56,6 +76,22 @@ static void BM_SimpleData_ParserComparison_StrictParser(benchmark::State& state)
     };
     BM_ParserComparison_TestBody(state, cfg, simple_csv_data);
 }
+static void BM_SimpleData_ParserComparison_SwarStrictParser(benchmark::State& state) {
+    Config cfg{
+        .has_header = true,
+        .has_quoting = true,
+        .parse_mode = Config::ParseMode::strict,
+        .line_ending = Config::LineEnding::lf,
+        .kernel = Config::Kernel::swar,
+    };
+    BM_ParserComparison_TestBody(state, cfg, simple_csv_data);
+}
+static void BM_SimpleData_ParserComparison_DialectStrictParser(benchmark::State& state) {
+    Config cfg{
+        .has_header = true,
+    };
+    BM_ParserComparison_TestBody<DialectReader<Rfc4180Dialect>>(state, cfg, simple_csv_data);
+}
 static void BM_SimpleData_ParserComparison_LenientParser(benchmark::State& state) {
     Config cfg{
         .has_header = true,
@@ -66,15 +102,27 @@ static void BM_SimpleData_ParserComparison_LenientParser(benchmark::State& state
     BM_ParserComparison_TestBody(state, cfg, simple_csv_data);
 }
 BENCHMARK(BM_SimpleData_ParserComparison_SimpleParser)->Arg(small_data)->Iterations(iterations);
+BENCHMARK(BM_SimpleData_ParserComparison_SimdParser)->Arg(small_data)->Iterations(iterations);
+BENCHMARK(BM_SimpleData_ParserComparison_SwarParser)->Arg(small_data)->Iterations(iterations);
 BENCHMARK(BM_SimpleData_ParserComparison_StrictParser)->Arg(small_data)->Iterations(iterations);
+BENCHMARK(BM_SimpleData_ParserComparison_SwarStrictParser)->Arg(small_data)->Iterations(iterations);
+BENCHMARK(BM_SimpleData_ParserComparison_DialectStrictParser)->Arg(small_data)->Iterations(iterations);
 BENCHMARK(BM_SimpleData_ParserComparison_LenientParser)->Arg(small_data)->Iterations(iterations);
 
 BENCHMARK(BM_SimpleData_ParserComparison_SimpleParser)->Arg(medium_data)->Iterations(iterations);
+BENCHMARK(BM_SimpleData_ParserComparison_SimdParser)->Arg(medium_data)->Iterations(iterations);
+BENCHMARK(BM_SimpleData_ParserComparison_SwarParser)->Arg(medium_data)->Iterations(iterations);
 BENCHMARK(BM_SimpleData_ParserComparison_StrictParser)->Arg(medium_data)->Iterations(iterations);
+BENCHMARK(BM_SimpleData_ParserComparison_SwarStrictParser)->Arg(medium_data)->Iterations(iterations);
+BENCHMARK(BM_SimpleData_ParserComparison_DialectStrictParser)->Arg(medium_data)->Iterations(iterations);
 BENCHMARK(BM_SimpleData_ParserComparison_LenientParser)->Arg(medium_data)->Iterations(iterations);
 
 BENCHMARK(BM_SimpleData_ParserComparison_SimpleParser)->Arg(big_data)->Iterations(iterations);
+BENCHMARK(BM_SimpleData_ParserComparison_SimdParser)->Arg(big_data)->Iterations(iterations);
+BENCHMARK(BM_SimpleData_ParserComparison_SwarParser)->Arg(big_data)->Iterations(iterations);
 BENCHMARK(BM_SimpleData_ParserComparison_StrictParser)->Arg(big_data)->Iterations(iterations);
+BENCHMARK(BM_SimpleData_ParserComparison_SwarStrictParser)->Arg(big_data)->Iterations(iterations);
+BENCHMARK(BM_SimpleData_ParserComparison_DialectStrictParser)->Arg(big_data)->Iterations(iterations);
 BENCHMARK(BM_SimpleData_ParserComparison_LenientParser)->Arg(big_data)->Iterations(iterations);
 
 
@@ -89,6 +137,16 @@ static void BM_QuotedData_ParserComparison_StrictParser(benchmark::State& state)
     };
     BM_ParserComparison_TestBody(state, cfg, quoted_csv_data);
 }
+static void BM_QuotedData_ParserComparison_SwarStrictParser(benchmark::State& state) {
+    Config cfg{
+        .has_header = true,
+        .has_quoting = true,
+        .parse_mode = Config::ParseMode::strict,
+        .line_ending = Config::LineEnding::lf,
+        .kernel = Config::Kernel::swar,
+    };
+    BM_ParserComparison_TestBody(state, cfg, quoted_csv_data);
+}
 static void BM_QuotedData_ParserComparison_LenientParser(benchmark::State& state) {
     Config cfg{
         .has_header = true,
@@ -98,13 +156,48 @@ static void BM_QuotedData_ParserComparison_LenientParser(benchmark::State& state
     };
     BM_ParserComparison_TestBody(state, cfg, quoted_csv_data);
 }
+static void BM_QuotedData_ParserComparison_DialectStrictParser(benchmark::State& state) {
+    Config cfg{
+        .has_header = true,
+    };
+    BM_ParserComparison_TestBody<DialectReader<Rfc4180Dialect>>(state, cfg, quoted_csv_data);
+}
+static void BM_QuotedData_ParserComparison_ScalarStrictParser(benchmark::State& state) {
+    Config cfg{
+        .has_header = true,
+        .has_quoting = true,
+        .parse_mode = Config::ParseMode::strict,
+        .line_ending = Config::LineEnding::lf,
+        .kernel = Config::Kernel::scalar,
+    };
+    BM_ParserComparison_TestBody(state, cfg, quoted_csv_data);
+}
+static void BM_QuotedData_ParserComparison_DialectScalarStrictParser(benchmark::State& state) {
+    Config cfg{
+        .has_header = true,
+        .kernel = Config::Kernel::scalar,
+    };
+    BM_ParserComparison_TestBody<DialectReader<Rfc4180Dialect>>(state, cfg, quoted_csv_data);
+}
 BENCHMARK(BM_QuotedData_ParserComparison_StrictParser)->Arg(small_data)->Iterations(iterations);
+BENCHMARK(BM_QuotedData_ParserComparison_SwarStrictParser)->Arg(small_data)->Iterations(iterations);
 BENCHMARK(BM_QuotedData_ParserComparison_LenientParser)->Arg(small_data)->Iterations(iterations);
+BENCHMARK(BM_QuotedData_ParserComparison_DialectStrictParser)->Arg(small_data)->Iterations(iterations);
+BENCHMARK(BM_QuotedData_ParserComparison_ScalarStrictParser)->Arg(small_data)->Iterations(iterations);
+BENCHMARK(BM_QuotedData_ParserComparison_DialectScalarStrictParser)->Arg(small_data)->Iterations(iterations);
 
 BENCHMARK(BM_QuotedData_ParserComparison_StrictParser)->Arg(medium_data)->Iterations(iterations);
+BENCHMARK(BM_QuotedData_ParserComparison_SwarStrictParser)->Arg(medium_data)->Iterations(iterations);
 BENCHMARK(BM_QuotedData_ParserComparison_LenientParser)->Arg(medium_data)->Iterations(iterations);
+BENCHMARK(BM_QuotedData_ParserComparison_DialectStrictParser)->Arg(medium_data)->Iterations(iterations);
+BENCHMARK(BM_QuotedData_ParserComparison_ScalarStrictParser)->Arg(medium_data)->Iterations(iterations);
+BENCHMARK(BM_QuotedData_ParserComparison_DialectScalarStrictParser)->Arg(medium_data)->Iterations(iterations);
 
 BENCHMARK(BM_QuotedData_ParserComparison_StrictParser)->Arg(big_data)->Iterations(iterations);
+BENCHMARK(BM_QuotedData_ParserComparison_SwarStrictParser)->Arg(big_data)->Iterations(iterations);
 BENCHMARK(BM_QuotedData_ParserComparison_LenientParser)->Arg(big_data)->Iterations(iterations);
+BENCHMARK(BM_QuotedData_ParserComparison_DialectStrictParser)->Arg(big_data)->Iterations(iterations);
+BENCHMARK(BM_QuotedData_ParserComparison_ScalarStrictParser)->Arg(big_data)->Iterations(iterations);
+BENCHMARK(BM_QuotedData_ParserComparison_DialectScalarStrictParser)->Arg(big_data)->Iterations(iterations);
 
 }
\ No newline at end of file
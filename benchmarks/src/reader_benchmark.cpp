@@ -1,12 +1,18 @@
 #include <benchmark/benchmark.h>
 
 #include <csvreader/csvreader.hpp>
+#include <csvreader/csvbasicreader.hpp>
+#include <csvbuffer/csvmemorybuffer.hpp>
 #include <csvconfig.hpp>
 
 #include <testdata.hpp>
 #include <helpers.hpp>
 #include <sstream>
 #include <string>
+#include <atomic>
+#include <functional>
+#include <mutex>
+#include <thread>
 
 namespace csv {
 
@@ -83,4 +89,189 @@ static void BM_Reader_QuotedData_EndToEnd(benchmark::State& state) {
 BENCHMARK(BM_Reader_QuotedData_EndToEnd)
     ->Arg(small_data)->Arg(medium_data)->Arg(big_data);
 
-}
\ No newline at end of file
+// Benchmark: same as BM_Reader_Stream_EndToEnd, records read a batch at a time
+static void BM_Reader_Stream_NextBatch(benchmark::State& state) {
+    const int repeats = static_cast<int>(state.range(0));
+    const std::string csv_text = repeat_csv(simple_csv_data, repeats);
+
+    Config cfg{};
+    cfg.has_header = true;
+    cfg.parse_mode = Config::ParseMode::strict;
+    cfg.has_quoting = true;
+    cfg.line_ending = Config::LineEnding::lf;
+
+    std::size_t total_rows = 0;
+    RecordBatch batch;
+
+    for (auto _ : state) {
+        auto stream = std::make_unique<std::istringstream>(csv_text);
+        Reader reader(std::move(stream), cfg);
+
+        while (reader.next_batch(batch)) {
+            total_rows += batch.size();
+            benchmark::DoNotOptimize(batch);
+        }
+
+        benchmark::DoNotOptimize(total_rows);
+    }
+
+    state.SetItemsProcessed(static_cast<int64_t>(total_rows));
+    state.SetBytesProcessed(static_cast<int64_t>(state.iterations()) * csv_text.size());
+}
+BENCHMARK(BM_Reader_Stream_NextBatch)
+    ->Arg(small_data)->Arg(medium_data)->Arg(big_data);
+
+// A payload that is already in memory: wrapped in an istringstream it is copied through StreamBuffer,
+// a MemoryBuffer parses it in place
+template <typename MakeBuffer>
+static void view_reader_in_memory(benchmark::State& state, MakeBuffer make_buffer) {
+    const std::string csv_text = repeat_csv(quoted_csv_data, static_cast<int>(state.range(0)));
+    std::size_t total_rows = 0;
+
+    for (auto _ : state) {
+        ViewReader reader(make_buffer(csv_text), Config{});
+
+        while (reader.next()) {
+            total_rows++;
+            benchmark::DoNotOptimize(reader.current_record());
+        }
+
+        benchmark::DoNotOptimize(total_rows);
+    }
+
+    state.SetItemsProcessed(static_cast<int64_t>(total_rows));
+    state.SetBytesProcessed(static_cast<int64_t>(state.iterations()) * csv_text.size());
+}
+
+static void BM_ViewReader_StringStream_InMemory(benchmark::State& state) {
+    view_reader_in_memory(state, [](const std::string& text) {
+        return make_stream_buffer(std::make_unique<std::istringstream>(text));
+    });
+}
+BENCHMARK(BM_ViewReader_StringStream_InMemory)->Arg(medium_data)->Arg(big_data);
+
+static void BM_ViewReader_MemoryBuffer_InMemory(benchmark::State& state) {
+    view_reader_in_memory(state, [](const std::string& text) {
+        return make_memory_buffer(text);
+    });
+}
+BENCHMARK(BM_ViewReader_MemoryBuffer_InMemory)->Arg(medium_data)->Arg(big_data);
+
+// Short rows: parsing a record is a few bytes of work, so the per-record virtual calls
+// of Reader / ViewReader into IBuffer and Parser are a large share of the time.
+// The BasicReader cases read the same data with the same buffer and parser types bound statically.
+static std::string short_rows(int64_t rows) {
+    std::string text;
+    for (int64_t i = 0; i < rows; i++) {
+        text += std::to_string(i % 10) + ",a\n";
+    }
+    return text;
+}
+
+constexpr Config short_rows_config{.has_header = false, .has_quoting = false, .kernel = Config::Kernel::avx2};
+
+template <typename ReaderType>
+static void read_short_rows(benchmark::State& state) {
+    const std::string csv_text = short_rows(state.range(0));
+    std::size_t total_rows = 0;
+
+    for (auto _ : state) {
+        ReaderType reader(std::make_unique<std::istringstream>(csv_text), short_rows_config);
+
+        while (reader.next()) {
+            total_rows++;
+            benchmark::DoNotOptimize(reader.current_record());
+        }
+
+        benchmark::DoNotOptimize(total_rows);
+    }
+
+    state.SetItemsProcessed(static_cast<int64_t>(total_rows));
+    state.SetBytesProcessed(static_cast<int64_t>(state.iterations()) * csv_text.size());
+}
+
+static void BM_Reader_ShortRows(benchmark::State& state) {
+    read_short_rows<Reader>(state);
+}
+BENCHMARK(BM_Reader_ShortRows)->Arg(big_data)->Arg(10 * big_data);
+
+static void BM_BasicReader_ShortRows(benchmark::State& state) {
+    read_short_rows<BasicReader<StreamBuffer<>, SimdParser>>(state);
+}
+BENCHMARK(BM_BasicReader_ShortRows)->Arg(big_data)->Arg(10 * big_data);
+
+static void BM_ViewReader_ShortRows(benchmark::State& state) {
+    read_short_rows<ViewReader>(state);
+}
+BENCHMARK(BM_ViewReader_ShortRows)->Arg(big_data)->Arg(10 * big_data);
+
+static void BM_BasicViewReader_ShortRows(benchmark::State& state) {
+    read_short_rows<BasicReader<StreamBuffer<>, ViewSimdParser>>(state);
+}
+BENCHMARK(BM_BasicViewReader_ShortRows)->Arg(big_data)->Arg(10 * big_data);
+
+// Order-independent per-row work on state.range(1) threads: sharing next() behind a mutex
+// (each thread copies its record before unlocking) against parallel_for_each over record batches
+static size_t row_work(std::string_view field) {
+    size_t hash = 0;
+    for (int round = 0; round < 8; round++) {
+        hash ^= std::hash<std::string_view>{}(field) + round;
+    }
+    return hash;
+}
+
+static void BM_ViewReader_MutexSharedNext(benchmark::State& state) {
+    const std::string csv_text = repeat_csv(simple_csv_data, static_cast<int>(state.range(0)));
+    const auto threads = static_cast<size_t>(state.range(1));
+
+    for (auto _ : state) {
+        ViewReader reader(make_memory_buffer(csv_text), Config{});
+        std::mutex mutex;
+        std::atomic<size_t> checksum{0};
+
+        std::vector<std::thread> workers;
+        for (size_t t = 0; t < threads; t++) {
+            workers.emplace_back([&] {
+                std::vector<std::string> fields;
+                while (true) {
+                    {
+                        std::lock_guard lock(mutex);
+                        if (!reader.next()) break;
+                        const auto& record = reader.current_record().fields();
+                        fields.assign(record.begin(), record.end());
+                    }
+                    size_t hash = 0;
+                    for (const auto& field : fields) hash ^= row_work(field);
+                    checksum.fetch_xor(hash, std::memory_order_relaxed);
+                }
+            });
+        }
+        for (auto& worker : workers) worker.join();
+        benchmark::DoNotOptimize(checksum.load());
+    }
+
+    state.SetBytesProcessed(static_cast<int64_t>(state.iterations()) * csv_text.size());
+}
+BENCHMARK(BM_ViewReader_MutexSharedNext)->Args({big_data, 1})->Args({big_data, 4})->UseRealTime();
+
+static void BM_ViewReader_ParallelForEach(benchmark::State& state) {
+    const std::string csv_text = repeat_csv(simple_csv_data, static_cast<int>(state.range(0)));
+    const auto threads = static_cast<size_t>(state.range(1));
+
+    for (auto _ : state) {
+        ViewReader reader(make_memory_buffer(csv_text), Config{});
+        std::atomic<size_t> checksum{0};
+
+        reader.parallel_for_each([&](const RecordBatch::RecordRef& record) {
+            size_t hash = 0;
+            for (size_t i = 0; i < record.size(); i++) hash ^= row_work(record[i]);
+            checksum.fetch_xor(hash, std::memory_order_relaxed);
+        }, threads);
+        benchmark::DoNotOptimize(checksum.load());
+    }
+
+    state.SetBytesProcessed(static_cast<int64_t>(state.iterations()) * csv_text.size());
+}
+BENCHMARK(BM_ViewReader_ParallelForEach)->Args({big_data, 1})->Args({big_data, 4})->UseRealTime();
+
+}
@@ -1,6 +1,7 @@
 #include<benchmark/benchmark.h>
 
 #include <csvbuffer/csvstreambuffer.hpp>
+#include <csvbuffer/csvringbuffer.hpp>
 #include <csvreader/csvreader.hpp>
 #include <csvconfig.hpp>
 
@@ -47,6 +48,57 @@ static void BM_Reader_BufferSized_EndToEnd(benchmark::State& state) {
     state.SetBytesProcessed(static_cast<int64_t>(state.iterations()) * csv_text.size());
 }
 
+// Benchmark: ViewReader, where a record cut by the end of the buffer is compacted to the front
+// and its views rebased (StreamBuffer<N>), or stays where it is (RingBuffer, mirrored mapping).
+// The ring is at least one page, so sizes start at 4096.
+template <typename MakeBuffer>
+static void view_reader_end_to_end(benchmark::State& state, MakeBuffer make_buffer) {
+    const int repeats = static_cast<int>(state.range(0));
+    const std::string csv_text = repeat_csv(simple_csv_data, repeats);
+
+    Config cfg{};
+    cfg.has_header = true;
+    cfg.parse_mode = Config::ParseMode::strict;
+    cfg.has_quoting = true;
+    cfg.line_ending = Config::LineEnding::lf;
+
+    std::size_t total_rows = 0;
+
+    for (auto _ : state) {
+        ViewReader reader(make_buffer(std::make_unique<std::istringstream>(csv_text)), cfg);
+
+        while (reader.next()) {
+            total_rows++;
+            benchmark::DoNotOptimize(reader.current_record());
+        }
+
+        benchmark::DoNotOptimize(total_rows);
+    }
+    state.SetItemsProcessed(static_cast<int64_t>(total_rows));
+    state.SetBytesProcessed(static_cast<int64_t>(state.iterations()) * csv_text.size());
+}
+
+template <size_t N>
+static void BM_ViewReader_StreamBuffer_EndToEnd(benchmark::State& state) {
+    view_reader_end_to_end(state, [](std::unique_ptr<std::istream> stream) {
+        return std::make_unique<StreamBuffer<N>>(std::move(stream));
+    });
+}
+
+template <size_t N>
+static void BM_ViewReader_RingBuffer_EndToEnd(benchmark::State& state) {
+    view_reader_end_to_end(state, [](std::unique_ptr<std::istream> stream) {
+        return std::make_unique<RingBuffer>(std::move(stream), N);
+    });
+}
+
+BENCHMARK(BM_ViewReader_StreamBuffer_EndToEnd<4096>)->Arg(big_data);
+BENCHMARK(BM_ViewReader_RingBuffer_EndToEnd<4096>)->Arg(big_data);
+BENCHMARK(BM_ViewReader_StreamBuffer_EndToEnd<16384>)->Arg(big_data);
+BENCHMARK(BM_ViewReader_RingBuffer_EndToEnd<16384>)->Arg(big_data);
+BENCHMARK(BM_ViewReader_StreamBuffer_EndToEnd<65536>)->Arg(big_data);
+BENCHMARK(BM_ViewReader_RingBuffer_EndToEnd<65536>)->Arg(big_data);
+
 // Register a few sizes (tiny -> default-ish)
 BENCHMARK(BM_Reader_BufferSized_EndToEnd<64>)->Arg(small_data)->Arg(medium_data)->Arg(big_data);
 BENCHMARK(BM_Reader_BufferSized_EndToEnd<256>)->Arg(small_data)->Arg(medium_data)->Arg(big_data);
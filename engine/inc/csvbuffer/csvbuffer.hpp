@@ -8,15 +8,13 @@
 #include <cstring>
 #include <stdexcept>
 
+#include <csvconfig.hpp>
 #include <csverrors.hpp>
 
 namespace csv {
 
 enum class ReadingResult { ok, eof, buffer_full, fail };
 
-// 2KB chosen to optimize for L1 Cache locality (See BENCHMARKING.md)
-constexpr size_t DEFAULT_CAPACITY = 2048;
-
 class IBuffer {
 public:
     virtual ~IBuffer() = default;
@@ -30,6 +28,25 @@ public:
     virtual bool eof() const noexcept = 0;
     virtual bool good() const noexcept = 0;
     virtual bool reset() = 0;
+
+    /// @brief makes a refill() blocked on another thread, and every later one until reset(), fail.
+    ///        Safe to call from any thread; buffers whose refill() cannot block forever ignore it
+    virtual void interrupt() noexcept {}
+
+    /// @brief true when refill() may wait for a writer (a pipe, socket or terminal) instead of
+    ///        returning what a file already holds
+    virtual bool may_block() const noexcept { return false; }
 };
 
+/// @brief moves the leftover of the current record, window[start, size), to window + offset,
+///        so that refill() can read behind it
+inline void compact_window(char* window, size_t& start, size_t& size, size_t offset = 0) noexcept {
+    const size_t leftover = size - start;
+    if (leftover && start != offset) {
+        std::memmove(window + offset, window + start, leftover);
+    }
+    start = offset;
+    size = offset + leftover;
+}
+
 }
\ No newline at end of file
@@ -0,0 +1,88 @@
+#pragma once
+
+#include <cstddef>
+#include <istream>
+#include <memory>
+#include <string_view>
+#include <csvbuffer/csvbuffer.hpp>
+
+namespace csv {
+
+enum class Compression { none, gzip, zstd };
+
+/// @return the compression recognized by the magic bytes at the beginning of data
+Compression detect_compression(std::string_view data) noexcept;
+
+/// @brief reads a gzip or zstd compressed source buffer and inflates it chunk by chunk straight into the parse
+///        window, so a .csv.gz / .csv.zst file is parsed without decompressing it to disk first. The source can be
+///        any IBuffer (the file buffer a reader picked by buffer_kind); the decoder works on its view, without
+///        another copy. The format is detected by its magic bytes; uncompressed data is copied through.
+///        Concatenated gzip members and zstd frames are read one after another. Corrupt or truncated data
+///        makes refill() fail.
+///        Wrap it in a ReadAheadBuffer to decompress on a helper thread, overlapped with parsing.
+class DecompressingBuffer : public IBuffer {
+    public:
+        static constexpr size_t DEFAULT_WINDOW_SIZE = 64 * 1024;
+        static constexpr size_t INPUT_CHUNK_SIZE = 64 * 1024;   // window of the source opened from a file or stream
+
+        // codec interface, the gzip / zstd / copy implementations live in the source file
+        class Decoder;
+
+        /// @param window_size size of the parse window the data is inflated into
+        /// @throws DecompressionError when the data uses a codec the library was built without
+        explicit DecompressingBuffer(std::string_view filename, size_t window_size = DEFAULT_WINDOW_SIZE);
+        explicit DecompressingBuffer(std::unique_ptr<std::istream> stream, size_t window_size = DEFAULT_WINDOW_SIZE);
+        /// @param source buffer of the compressed bytes, it may already hold data read by an earlier refill()
+        explicit DecompressingBuffer(std::unique_ptr<IBuffer> source, size_t window_size = DEFAULT_WINDOW_SIZE);
+        ~DecompressingBuffer();
+
+        DecompressingBuffer(const DecompressingBuffer&) = delete;
+        DecompressingBuffer& operator=(const DecompressingBuffer&) = delete;
+
+        DecompressingBuffer(DecompressingBuffer&&) noexcept;
+        DecompressingBuffer& operator=(DecompressingBuffer&&) noexcept;
+
+        ReadingResult refill() override;
+        std::string_view view() const noexcept override;
+        void consume(size_t bytes) noexcept override;
+        size_t available() const noexcept override;
+        size_t capacity() const noexcept override;
+        bool empty() const noexcept override;
+        bool eof() const noexcept override;
+        bool good() const noexcept override;
+        bool reset() override;
+        void interrupt() noexcept override;
+        bool may_block() const noexcept override;
+
+        Compression compression() const noexcept;
+
+    private:
+        std::unique_ptr<IBuffer> source_;
+        Compression compression_ = Compression::none;
+        std::unique_ptr<Decoder> decoder_;
+
+        size_t window_size_;
+        std::unique_ptr<char[]> data_;
+        size_t start_ = 0;
+        size_t size_ = 0;
+
+        bool finished_ = false;           // the compressed source ended
+        bool failed_ = false;
+};
+
+inline std::unique_ptr<IBuffer> make_decompressing_buffer(std::string_view filename,
+                                                          size_t window_size = DecompressingBuffer::DEFAULT_WINDOW_SIZE) {
+    return std::make_unique<DecompressingBuffer>(filename, window_size);
+}
+
+inline std::unique_ptr<IBuffer> make_decompressing_buffer(std::unique_ptr<std::istream> stream,
+                                                          size_t window_size = DecompressingBuffer::DEFAULT_WINDOW_SIZE) {
+    return std::make_unique<DecompressingBuffer>(std::move(stream), window_size);
+}
+
+inline std::unique_ptr<IBuffer> make_decompressing_buffer(std::unique_ptr<IBuffer> source,
+                                                          size_t window_size = DecompressingBuffer::DEFAULT_WINDOW_SIZE) {
+    return std::make_unique<DecompressingBuffer>(std::move(source), window_size);
+}
+
+}
@@ -0,0 +1,82 @@
+#pragma once
+
+#include <cstddef>
+#include <cstdlib>
+#include <string_view>
+#include <memory>
+#include <csvbuffer/csvbuffer.hpp>
+
+namespace csv {
+
+/// @brief reads a file with read() straight into the parse window, without the internal buffer and
+///        sentry of std::ifstream. The file is advised as sequential and read once (POSIX_FADV_SEQUENTIAL,
+///        POSIX_FADV_NOREUSE). With direct_io the file is opened with O_DIRECT and read in aligned blocks,
+///        so a one-pass scan does not push other data out of the page cache; the leftover of the current
+///        record is then moved just before the next aligned block, and a record can use up to
+///        capacity - DIRECT_IO_ALIGNMENT bytes. When the file system refuses O_DIRECT the reads are buffered.
+///        An already open descriptor (a pipe, stdin) can be read too; it is not closed by the buffer.
+///        A descriptor that is not a regular file may block in read(), it is polled together with an
+///        eventfd so that interrupt() can wake the read.
+class FdBuffer : public IBuffer {
+    public:
+        static constexpr size_t DEFAULT_CAPACITY = 64 * 1024;
+        static constexpr size_t DIRECT_IO_ALIGNMENT = 4096;
+
+        /// @param capacity size of the parse window, with direct_io rounded up to DIRECT_IO_ALIGNMENT
+        explicit FdBuffer(std::string_view filename, size_t capacity = DEFAULT_CAPACITY, bool direct_io = false);
+        /// @brief reads fd from its current position, a descriptor that cannot seek cannot be reset()
+        explicit FdBuffer(int fd, size_t capacity = DEFAULT_CAPACITY);
+        ~FdBuffer();
+
+        FdBuffer(const FdBuffer&) = delete;
+        FdBuffer& operator=(const FdBuffer&) = delete;
+
+        FdBuffer(FdBuffer&&) noexcept;
+        FdBuffer& operator=(FdBuffer&&) noexcept;
+
+        ReadingResult refill() override;
+        std::string_view view() const noexcept override;
+        void consume(size_t bytes) noexcept override;
+        size_t available() const noexcept override;
+        size_t capacity() const noexcept override;
+        bool empty() const noexcept override;
+        bool eof() const noexcept override;
+        bool good() const noexcept override;
+        bool reset() override;
+        void interrupt() noexcept override;
+        bool may_block() const noexcept override;
+
+        /// @brief true when the file is read with O_DIRECT
+        bool direct() const noexcept;
+
+    protected:
+        int fd() const noexcept;
+
+    private:
+        struct FreeDeleter {
+            void operator()(char* ptr) const noexcept { std::free(ptr); }
+        };
+
+        static std::unique_ptr<char, FreeDeleter> allocate_window(size_t capacity);
+        bool drop_direct_io() noexcept;
+        void watch_interrupts();
+        bool wait_readable() noexcept;
+
+        int fd_ = -1;
+        bool owns_fd_ = true;
+        int interrupt_fd_ = -1;      // eventfd, only for descriptors whose read() may block
+        bool direct_ = false;
+        bool eof_ = false;
+        bool failed_ = false;
+
+        size_t capacity_ = 0;
+        std::unique_ptr<char, FreeDeleter> data_;
+        size_t start_ = 0;
+        size_t size_ = 0;
+};
+
+inline std::unique_ptr<IBuffer> make_fd_buffer(std::string_view filename, bool direct_io = false) {
+    return std::make_unique<FdBuffer>(filename, FdBuffer::DEFAULT_CAPACITY, direct_io);
+}
+
+}
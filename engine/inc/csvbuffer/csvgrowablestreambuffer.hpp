@@ -0,0 +1,71 @@
+#pragma once
+
+#include <cstddef>
+#include <istream>
+#include <memory>
+#include <string_view>
+#include <csvbuffer/csvbuffer.hpp>
+
+namespace csv {
+
+/// @brief StreamBuffer with its capacity chosen at runtime. When a record does not fit, refill() doubles
+///        the window (up to max_capacity) instead of reporting buffer_full, and once the outlier is
+///        consumed it shrinks back to the initial capacity, so normal rows keep the small cache-friendly window.
+class GrowableStreamBuffer : public IBuffer {
+    public:
+        static constexpr size_t UNLIMITED = 0;
+
+        /// @param capacity initial and normal size of the window
+        /// @param max_capacity the window does not grow past it, UNLIMITED lets it grow as needed
+        explicit GrowableStreamBuffer(std::string_view filename,
+                                      size_t capacity = DEFAULT_CAPACITY,
+                                      size_t max_capacity = UNLIMITED);
+
+        explicit GrowableStreamBuffer(std::unique_ptr<std::istream> stream,
+                                      size_t capacity = DEFAULT_CAPACITY,
+                                      size_t max_capacity = UNLIMITED);
+
+        GrowableStreamBuffer(const GrowableStreamBuffer&) = delete;
+        GrowableStreamBuffer& operator=(const GrowableStreamBuffer&) = delete;
+
+        GrowableStreamBuffer(GrowableStreamBuffer&&) noexcept = default;
+        GrowableStreamBuffer& operator=(GrowableStreamBuffer&&) noexcept = default;
+
+        ReadingResult refill() override;
+        std::string_view view() const noexcept override;
+        void consume(size_t bytes) noexcept override;
+        size_t available() const noexcept override;
+        size_t capacity() const noexcept override;
+        bool empty() const noexcept override;
+        bool eof() const noexcept override;
+        bool good() const noexcept override;
+        bool reset() override;
+
+        size_t initial_capacity() const noexcept;
+        size_t max_capacity() const noexcept;
+
+    private:
+        void resize(size_t new_capacity);
+
+        std::unique_ptr<std::istream> stream_;
+        size_t initial_capacity_;
+        size_t max_capacity_;
+        size_t capacity_;
+        std::unique_ptr<char[]> data_;
+        size_t start_ = 0;
+        size_t size_ = 0;
+};
+
+inline std::unique_ptr<IBuffer> make_growable_stream_buffer(std::string_view filename,
+                                                            size_t capacity = DEFAULT_CAPACITY,
+                                                            size_t max_capacity = GrowableStreamBuffer::UNLIMITED) {
+    return std::make_unique<GrowableStreamBuffer>(filename, capacity, max_capacity);
+}
+
+inline std::unique_ptr<IBuffer> make_growable_stream_buffer(std::unique_ptr<std::istream> stream,
+                                                            size_t capacity = DEFAULT_CAPACITY,
+                                                            size_t max_capacity = GrowableStreamBuffer::UNLIMITED) {
+    return std::make_unique<GrowableStreamBuffer>(std::move(stream), capacity, max_capacity);
+}
+
+}
@@ -1,15 +1,32 @@
 #pragma once
 
 #include <cstddef>
+#include <cstdint>
 #include <string_view>
 #include <memory>
 #include <csvbuffer/csvbuffer.hpp>
 
 namespace csv {
 
+/// @brief how MappedBuffer asks the kernel to bring the mapped pages in
+struct MappingOptions {
+    bool populate = false;     // MAP_POPULATE: read the whole window in at mmap time instead of faulting page by page
+    bool huge_pages = false;   // MADV_HUGEPAGE: fewer, larger page faults where the file system supports it
+    size_t prefetch = 0;       // MADV_WILLNEED this many bytes ahead of the read position, 0 leaves it to the kernel read-ahead
+};
+
+/// @brief maps the file into memory. By default the whole file is mapped once; with a window_size only
+///        that many bytes are mapped at a time, and refill() maps the next page-aligned window starting at
+///        the unconsumed data (so the current record stays contiguous) and unmaps the consumed one,
+///        which keeps the resident memory of big files bounded. A record can use up to
+///        window_size - page size bytes in that mode.
 class MappedBuffer : public IBuffer {
     public:
-        explicit MappedBuffer(std::string_view filename);
+        static constexpr size_t WHOLE_FILE = 0;
+
+        /// @param window_size bytes mapped at a time, rounded up to the page size and at least two pages;
+        ///        WHOLE_FILE maps everything
+        explicit MappedBuffer(std::string_view filename, size_t window_size = WHOLE_FILE, MappingOptions options = {});
         ~MappedBuffer();
 
         MappedBuffer(const MappedBuffer&) = delete;
@@ -29,13 +46,27 @@ class MappedBuffer : public IBuffer {
         bool reset() override;
 
     private:
+        bool map_window(size_t offset) noexcept;
+        void unmap() noexcept;
+        void prefetch() noexcept;
+
+        int fd_ = -1;                // kept open only to map further windows
+        size_t file_size_ = 0;
+        size_t window_size_ = WHOLE_FILE;
+        size_t window_offset_ = 0;   // file offset of data_
+        MappingOptions options_;
+        size_t prefetched_ = 0;              // end of the range of the window already advised with MADV_WILLNEED
+        size_t prefetch_mark_ = SIZE_MAX;    // start_ at which consume() advises the next range
+
         size_t start_ = 0;
         size_t size_ = 0;
         char* data_ = nullptr;
 };
 
-inline std::unique_ptr<IBuffer> make_mapped_buffer(std::string_view filename) {
-    return std::make_unique<MappedBuffer>(filename);
+inline std::unique_ptr<IBuffer> make_mapped_buffer(std::string_view filename,
+                                                   size_t window_size = MappedBuffer::WHOLE_FILE,
+                                                   MappingOptions options = {}) {
+    return std::make_unique<MappedBuffer>(filename, window_size, options);
 }
 
-}
\ No newline at end of file
+}
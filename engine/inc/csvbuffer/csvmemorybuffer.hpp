@@ -0,0 +1,73 @@
+#pragma once
+
+#include <algorithm>
+#include <cstddef>
+#include <memory>
+#include <string_view>
+
+#include <csvbuffer/csvbuffer.hpp>
+
+namespace csv {
+
+/// @brief buffer over caller-owned contiguous memory, e.g. a payload already received from a message queue.
+///        The whole memory is the view from the start and nothing is ever copied or moved, so fields of a
+///        ViewReader that need no unescaping point into that memory and stay valid as long as it lives,
+///        not only until the next read. The memory must outlive the buffer.
+class MemoryBuffer final : public IBuffer {
+    public:
+        // a pointer and a size rather than a string_view, so BasicReader does not take it for a file name
+        MemoryBuffer(const char* data, size_t size) noexcept
+            : data_(data)
+            , size_(size)
+        {
+        }
+
+        // nothing follows the memory, the last record is complete once the view runs out
+        ReadingResult refill() override {
+            return ReadingResult::eof;
+        }
+
+        std::string_view view() const noexcept override {
+            return {data_ + start_, available()};
+        }
+
+        void consume(size_t bytes) noexcept override {
+            start_ += std::min(bytes, available());
+        }
+
+        size_t available() const noexcept override {
+            return size_ - start_;
+        }
+
+        size_t capacity() const noexcept override {
+            return size_;
+        }
+
+        bool empty() const noexcept override {
+            return start_ == size_;
+        }
+
+        bool eof() const noexcept override {
+            return empty();
+        }
+
+        bool good() const noexcept override {
+            return !empty();
+        }
+
+        bool reset() override {
+            start_ = 0;
+            return true;
+        }
+
+    private:
+        const char* data_;
+        size_t size_;
+        size_t start_ = 0;
+};
+
+inline std::unique_ptr<IBuffer> make_memory_buffer(std::string_view data) {
+    return std::make_unique<MemoryBuffer>(data.data(), data.size());
+}
+
+}
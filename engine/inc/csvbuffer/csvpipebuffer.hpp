@@ -0,0 +1,32 @@
+#pragma once
+
+#include <cstddef>
+#include <memory>
+#include <csvbuffer/csvfdbuffer.hpp>
+
+#include <unistd.h>
+
+namespace csv {
+
+/// @brief reads a pipe (or stdin) with read() straight into the parse window, without the internal buffer
+///        of an istream. The pipe is enlarged with F_SETPIPE_SZ, so a bursty producer can run further ahead
+///        before it blocks; when the kernel refuses the size (above /proc/sys/fs/pipe-max-size for an
+///        unprivileged process) or the descriptor is not a pipe, it is read as it is.
+///        The descriptor is not closed by the buffer. A pipe cannot be rewound, reset() fails.
+class PipeBuffer : public FdBuffer {
+    public:
+        static constexpr size_t DEFAULT_PIPE_SIZE = 1024 * 1024;
+
+        /// @param capacity size of the parse window
+        /// @param pipe_size requested size of the pipe buffer, 0 keeps the current one
+        explicit PipeBuffer(int fd = STDIN_FILENO, size_t capacity = DEFAULT_CAPACITY, size_t pipe_size = DEFAULT_PIPE_SIZE);
+
+        /// @return size of the kernel pipe buffer, 0 when fd is not a pipe
+        size_t pipe_size() const noexcept;
+};
+
+inline std::unique_ptr<IBuffer> make_pipe_buffer(int fd = STDIN_FILENO) {
+    return std::make_unique<PipeBuffer>(fd);
+}
+
+}
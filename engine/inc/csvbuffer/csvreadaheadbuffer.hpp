@@ -0,0 +1,98 @@
+#pragma once
+
+#include <atomic>
+#include <cstddef>
+#include <limits>
+#include <memory>
+#include <string_view>
+#include <thread>
+#include <csvbuffer/csvbuffer.hpp>
+
+namespace csv {
+
+/// @brief decorator that reads the source buffer on its own I/O thread, one block ahead of the parser.
+///        The thread fills two blocks in turn; each block is handed over with an atomic flag
+///        (set by the thread when the block is full, or for a source that may_block() as soon as it has
+///        no more buffered data; cleared by the parser when it is drained), so neither side takes a lock. refill() copies the next block
+///        behind the leftover of the current record, which keeps the usual refill()/view()/consume() contract.
+///        With a max_capacity above block_size the window doubles for a record that does not fit, like
+///        GrowableStreamBuffer, and goes back to block_size once the record is consumed.
+///        The destructor interrupts a read of the source that waits for input (FdBuffer, PipeBuffer);
+///        a blocking istream cannot be interrupted.
+class ReadAheadBuffer : public IBuffer {
+    public:
+        static constexpr size_t DEFAULT_BLOCK_SIZE = 64 * 1024;
+        static constexpr size_t UNLIMITED = std::numeric_limits<size_t>::max();
+
+        /// @param block_size size of each read-ahead block and of the normal parse window
+        /// @param max_capacity the window grows up to it for a longer record, UNLIMITED lets it grow as needed;
+        ///        the default keeps it at block_size
+        explicit ReadAheadBuffer(std::unique_ptr<IBuffer> source,
+                                 size_t block_size = DEFAULT_BLOCK_SIZE,
+                                 size_t max_capacity = 0);
+        ~ReadAheadBuffer();
+
+        ReadAheadBuffer(const ReadAheadBuffer&) = delete;
+        ReadAheadBuffer& operator=(const ReadAheadBuffer&) = delete;
+
+        // the I/O thread keeps a pointer to this object
+        ReadAheadBuffer(ReadAheadBuffer&&) = delete;
+        ReadAheadBuffer& operator=(ReadAheadBuffer&&) = delete;
+
+        ReadingResult refill() override;
+        std::string_view view() const noexcept override;
+        void consume(size_t bytes) noexcept override;
+        size_t available() const noexcept override;
+        size_t capacity() const noexcept override;
+        bool empty() const noexcept override;
+        bool eof() const noexcept override;
+        bool good() const noexcept override;
+        bool reset() override;
+        void interrupt() noexcept override;
+        bool may_block() const noexcept override;
+
+    private:
+        struct Block {
+            std::unique_ptr<char[]> data;
+            size_t length = 0;
+            size_t pos = 0;                          // bytes already copied into the window
+            ReadingResult end = ReadingResult::ok;   // eof or fail when the source ended in this block
+            std::atomic<bool> full{false};           // owned by the I/O thread while false, by the parser while true
+        };
+
+        void start();
+        void stop() noexcept;
+        void fill_blocks() noexcept;
+        void resize(size_t new_capacity);
+
+        std::unique_ptr<IBuffer> source_;   // used only by the I/O thread while it runs
+        Block blocks_[2];
+        size_t current_ = 0;                // block the parser copies from
+        std::atomic<bool> stopping_{false};
+        std::thread io_thread_;
+
+        bool finished_ = false;             // the source ended and its last block was copied
+        bool failed_ = false;
+
+        size_t block_size_;
+        size_t max_capacity_;
+        size_t capacity_;                   // of the window, block_size_ unless a long record grew it
+        std::unique_ptr<char[]> data_;
+        size_t start_ = 0;
+        size_t size_ = 0;
+};
+
+inline std::unique_ptr<IBuffer> make_read_ahead_buffer(std::unique_ptr<IBuffer> source, size_t max_capacity = 0) {
+    return std::make_unique<ReadAheadBuffer>(std::move(source), ReadAheadBuffer::DEFAULT_BLOCK_SIZE, max_capacity);
+}
+
+/// @brief read-ahead for a reader's buffer: with BufferKind::growable the window grows up to max_buffer_capacity
+inline std::unique_ptr<IBuffer> make_read_ahead_buffer(std::unique_ptr<IBuffer> source, const Config& config) {
+    if (config.buffer_kind != Config::BufferKind::growable) {
+        return make_read_ahead_buffer(std::move(source));
+    }
+    const size_t max_capacity = config.max_buffer_capacity == 0 ? ReadAheadBuffer::UNLIMITED : config.max_buffer_capacity;
+    return make_read_ahead_buffer(std::move(source), max_capacity);
+}
+
+}
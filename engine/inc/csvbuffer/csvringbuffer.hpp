@@ -0,0 +1,58 @@
+#pragma once
+
+#include <cstddef>
+#include <istream>
+#include <memory>
+#include <string_view>
+#include <csvbuffer/csvbuffer.hpp>
+
+namespace csv {
+
+/// @brief stream buffer over a ring whose pages are mapped twice, back to back (a memfd mapped at
+///        base and at base + capacity). Data that wraps around the end of the ring is still contiguous
+///        in memory, so refill() reads behind the leftover without moving it: there is no compact() memmove,
+///        and the views of a ViewReader are rebased only once per lap around the ring, when refill()
+///        moves the read position from the mirror back to the first half.
+class RingBuffer : public IBuffer {
+    public:
+        /// @param capacity size of the ring, rounded up to the page size
+        explicit RingBuffer(std::string_view filename, size_t capacity = DEFAULT_CAPACITY);
+        explicit RingBuffer(std::unique_ptr<std::istream> stream, size_t capacity = DEFAULT_CAPACITY);
+        ~RingBuffer();
+
+        RingBuffer(const RingBuffer&) = delete;
+        RingBuffer& operator=(const RingBuffer&) = delete;
+
+        RingBuffer(RingBuffer&&) noexcept;
+        RingBuffer& operator=(RingBuffer&&) noexcept;
+
+        ReadingResult refill() override;
+        std::string_view view() const noexcept override;
+        void consume(size_t bytes) noexcept override;
+        size_t available() const noexcept override;
+        size_t capacity() const noexcept override;
+        bool empty() const noexcept override;
+        bool eof() const noexcept override;
+        bool good() const noexcept override;
+        bool reset() override;
+
+    private:
+        void map_ring();
+        void unmap_ring() noexcept;
+
+        std::unique_ptr<std::istream> stream_;
+        size_t capacity_ = 0;
+        char* data_ = nullptr;   // 2 * capacity_ bytes, the second half mirrors the first
+        size_t head_ = 0;        // read position, < capacity_ after refill(), consume() may take it into the mirror
+        size_t size_ = 0;        // bytes between head_ and the write position
+};
+
+inline std::unique_ptr<IBuffer> make_ring_buffer(std::string_view filename, size_t capacity = DEFAULT_CAPACITY) {
+    return std::make_unique<RingBuffer>(filename, capacity);
+}
+
+inline std::unique_ptr<IBuffer> make_ring_buffer(std::unique_ptr<std::istream> stream, size_t capacity = DEFAULT_CAPACITY) {
+    return std::make_unique<RingBuffer>(std::move(stream), capacity);
+}
+
+}
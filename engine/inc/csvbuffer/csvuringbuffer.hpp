@@ -0,0 +1,77 @@
+#pragma once
+
+#include <cstddef>
+#include <cstdint>
+#include <string_view>
+#include <memory>
+#include <vector>
+#include <csvbuffer/csvbuffer.hpp>
+
+namespace csv {
+
+/// @brief reads a file with up to queue_depth io_uring reads in flight, each into its own aligned block,
+///        so refill() usually finds the next block already read and only copies it behind the leftover
+///        of the current record. Uses the io_uring syscalls directly (no liburing); when io_uring is not
+///        available, or the file is not a regular file, the blocks are filled with blocking read() instead.
+class UringBuffer : public IBuffer {
+    public:
+        static constexpr size_t DEFAULT_BLOCK_SIZE = 64 * 1024;
+        static constexpr unsigned DEFAULT_QUEUE_DEPTH = 4;
+
+        /// @param block_size size of one read and of the parse window, rounded up to the page size
+        /// @param queue_depth number of blocks, 2..4 keep the device busy without much memory
+        explicit UringBuffer(std::string_view filename,
+                             size_t block_size = DEFAULT_BLOCK_SIZE,
+                             unsigned queue_depth = DEFAULT_QUEUE_DEPTH);
+        ~UringBuffer();
+
+        UringBuffer(const UringBuffer&) = delete;
+        UringBuffer& operator=(const UringBuffer&) = delete;
+
+        UringBuffer(UringBuffer&&) noexcept;
+        UringBuffer& operator=(UringBuffer&&) noexcept;
+
+        ReadingResult refill() override;
+        std::string_view view() const noexcept override;
+        void consume(size_t bytes) noexcept override;
+        size_t available() const noexcept override;
+        size_t capacity() const noexcept override;
+        bool empty() const noexcept override;
+        bool eof() const noexcept override;
+        bool good() const noexcept override;
+        bool reset() override;
+
+        /// @brief true when reads go through io_uring, false when they fell back to read()
+        bool asynchronous() const noexcept;
+
+    private:
+        struct Ring;
+        struct Block;
+
+        void close_all() noexcept;
+        void start_reads();
+        void submit(Block& block);
+        void complete(uint64_t index, int result);
+        bool wait(Block& block);
+        void wait_all() noexcept;
+
+        int fd_ = -1;
+        size_t file_size_ = 0;
+        size_t next_offset_ = 0;    // file offset of the next block to submit
+        bool failed_ = false;
+
+        std::unique_ptr<Ring> ring_;
+        std::vector<Block> blocks_;
+        size_t head_ = 0;           // block that is copied into the window next, blocks are used round-robin
+
+        size_t block_size_ = 0;
+        std::unique_ptr<char[]> data_;
+        size_t start_ = 0;
+        size_t size_ = 0;
+};
+
+inline std::unique_ptr<IBuffer> make_uring_buffer(std::string_view filename) {
+    return std::make_unique<UringBuffer>(filename);
+}
+
+}
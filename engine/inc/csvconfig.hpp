@@ -1,7 +1,12 @@
 #pragma once
 
+#include <cstddef>
+
 namespace csv {
 
+// 2KB chosen to optimize for L1 Cache locality (See BENCHMARKING.md)
+constexpr size_t DEFAULT_CAPACITY = 2048;
+
 struct Config {
     char delimiter = ',';
     bool has_header = true;
@@ -9,7 +14,28 @@ struct Config {
     char quote_char = '\"';
     
     bool streaming = true;
-    bool mapped_buffer = false;
+    bool mapped_buffer = false;      // deprecated, same as buffer_kind = mapped (any other buffer_kind is a ConfigError)
+    // Buffer that reads the input into the parse window.
+    // A reader over a std::istream takes stream, growable or ring, compressed input any but growable and ring;
+    // other kinds are a ConfigError.
+    enum class BufferKind {
+        stream,     // std::ifstream into a fixed window (StreamBuffer)
+        mapped,     // mmap the file (MappedBuffer)
+        uring,      // io_uring read-ahead (UringBuffer), Linux only
+        fd,         // plain read() into the parse window (FdBuffer)
+        direct_io,  // FdBuffer with O_DIRECT, for one-pass scans that should bypass the page cache
+        growable,   // stream buffer that grows for an oversized record (GrowableStreamBuffer)
+        ring        // stream buffer over a mirrored ring that never moves the leftover (RingBuffer)
+    };
+    BufferKind buffer_kind = BufferKind::stream;
+    size_t mapped_window = 0;    // with mapped, map this many bytes at a time instead of the whole file
+    bool mapped_populate = false;    // with mapped, MAP_POPULATE the mapping (no page faults while parsing)
+    bool mapped_huge_pages = false;  // with mapped, MADV_HUGEPAGE the mapping
+    size_t mapped_prefetch = 0;      // with mapped, MADV_WILLNEED this many bytes ahead of the read position
+    size_t buffer_capacity = DEFAULT_CAPACITY;  // window of the growable (initial) or ring buffer
+    size_t max_buffer_capacity = 0;  // growth limit of the growable buffer, 0 is unlimited
+    bool read_ahead = false;     // read the buffer one block ahead on a background thread (ReadAheadBuffer), growable keeps growing
+    bool decompress = true;      // inflate gzip / zstd files recognized by their magic bytes (DecompressingBuffer)
 
     enum class ParseMode { strict, lenient };
     ParseMode parse_mode = ParseMode::strict;
@@ -26,6 +52,13 @@ struct Config {
     RecordSizePolicy record_size_policy = RecordSizePolicy::strict_to_first;
     size_t record_size = 0; // Value used to specify expected size
 
+    // Structural-character scanning used by the parser.
+    // automatic picks the fastest kernel the CPU supports (or CSVENGINE_KERNEL when set),
+    // an explicit kernel that the CPU lacks degrades to the next slower one.
+    // Kernels are ordered from slowest to fastest.
+    enum class Kernel { automatic, scalar, swar, sse42, avx2, avx512 };
+    Kernel kernel = Kernel::automatic;
+
     int is_line_ending(char ch) const {
         switch (line_ending) {
             case LineEnding::crlf:
@@ -0,0 +1,66 @@
+#pragma once
+
+#include <csvconfig.hpp>
+
+namespace csv {
+
+/// @brief CSV dialect fixed at compile time.
+///        Parsers instantiated with it compare bytes against immediates instead of loading
+///        delimiter / quote / line ending from Config on every character.
+template <char Delimiter = ',',
+          char Quote = '"',
+          Config::LineEnding Ending = Config::LineEnding::lf,
+          Config::ParseMode Mode = Config::ParseMode::strict,
+          bool Quoting = true>
+struct Dialect {
+    static constexpr char delimiter = Delimiter;
+    static constexpr char quote = Quote;
+    static constexpr Config::LineEnding line_ending = Ending;
+    static constexpr Config::ParseMode parse_mode = Mode;
+    static constexpr bool has_quoting = Quoting;
+    static constexpr char newline = Ending == Config::LineEnding::cr ? '\r' : '\n';
+
+    /// @brief config with the dialect options replaced by this dialect, the rest is kept
+    static constexpr Config apply(Config config = {}) noexcept {
+        config.delimiter = delimiter;
+        config.quote_char = quote;
+        config.line_ending = line_ending;
+        config.parse_mode = parse_mode;
+        config.has_quoting = has_quoting;
+        return config;
+    }
+
+    /// @brief true when config describes this dialect
+    static constexpr bool matches(const Config& config) noexcept {
+        return config.delimiter == delimiter &&
+               config.quote_char == quote &&
+               config.line_ending == line_ending &&
+               config.parse_mode == parse_mode &&
+               config.has_quoting == has_quoting;
+    }
+};
+
+/// @brief the same interface filled from Config at runtime, used by the type-erased parsers
+struct RuntimeDialect {
+    explicit constexpr RuntimeDialect(const Config& config) noexcept
+        : delimiter(config.delimiter)
+        , quote(config.quote_char)
+        , line_ending(config.line_ending)
+        , parse_mode(config.parse_mode)
+        , has_quoting(config.has_quoting)
+        , newline(config.line_ending == Config::LineEnding::cr ? '\r' : '\n')
+    {}
+
+    char delimiter;
+    char quote;
+    Config::LineEnding line_ending;
+    Config::ParseMode parse_mode;
+    bool has_quoting;
+    char newline;
+};
+
+using Rfc4180Dialect = Dialect<>;
+using LenientDialect = Dialect<',', '"', Config::LineEnding::lf, Config::ParseMode::lenient>;
+using TsvDialect = Dialect<'\t', '"', Config::LineEnding::lf, Config::ParseMode::strict, false>;
+
+}
@@ -1,5 +1,10 @@
 #pragma once
 
 #include <csvconfig.hpp>
+#include <csvexecutor.hpp>
 #include <csvrecord/csvrecord.hpp>
 #include <csvreader/csvreader.hpp>
+#include <csvreader/csvparallelreader.hpp>
+#include <csvreader/csvpipelinedreader.hpp>
+#include <csvreader/csvdialectreader.hpp>
+#include <csvreader/csvbasicreader.hpp>
@@ -53,6 +53,11 @@ public:
     RecordColumnNameError(std::string_view column_name): std::runtime_error("Column " + std::string(column_name) + " doesn't exists in record.") {}
 };
 
+class DecompressionError : public std::runtime_error {
+public:
+    DecompressionError(const std::string& msg): std::runtime_error(msg) {}
+};
+
 class RecordTooLargeError : public std::runtime_error {
 public:
     RecordTooLargeError(): std::runtime_error("Too big field for current buffer size!") {}
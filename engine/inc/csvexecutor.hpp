@@ -0,0 +1,107 @@
+#pragma once
+
+#include <atomic>
+#include <condition_variable>
+#include <cstddef>
+#include <deque>
+#include <exception>
+#include <functional>
+#include <memory>
+#include <mutex>
+#include <thread>
+#include <vector>
+
+namespace csv {
+
+/// @brief runs the tasks of the parallel readers and algorithms. Implement it to run them on the
+///        application's own threads; by default all readers share default_executor().
+class Executor {
+public:
+    virtual ~Executor() = default;
+
+    /// @brief runs task later on some thread. Tasks do not throw, TaskGroup catches their exceptions
+    virtual void submit(std::function<void()> task) = 0;
+
+    /// @brief number of tasks that can run at the same time
+    virtual size_t concurrency() const noexcept = 0;
+};
+
+/// @brief thread pool with one task deque per worker. A worker takes its newest task from the back
+///        of its own deque and, when that is empty, steals the oldest task from the front of another
+///        worker's deque. Tasks submitted by a worker go to its own deque, others are spread round robin.
+///        The destructor runs the tasks still queued, then joins the workers.
+class WorkStealingExecutor final : public Executor {
+public:
+    /// @param threads number of workers, 0 uses one per hardware thread
+    explicit WorkStealingExecutor(size_t threads = 0);
+    ~WorkStealingExecutor() override;
+
+    WorkStealingExecutor(const WorkStealingExecutor&) = delete;
+    WorkStealingExecutor& operator=(const WorkStealingExecutor&) = delete;
+
+    void submit(std::function<void()> task) override;
+    size_t concurrency() const noexcept override;
+
+private:
+    struct alignas(64) Queue {
+        std::mutex mutex;
+        std::deque<std::function<void()>> tasks;
+    };
+
+    void work(size_t index) noexcept;
+    /// @brief the back of queue index, or the front of another queue
+    bool take_task(size_t index, std::function<void()>& task);
+
+    std::vector<std::unique_ptr<Queue>> queues_;
+    std::atomic<size_t> next_queue_{0};
+    std::atomic<size_t> queued_{0};
+
+    std::mutex sleep_mutex_;
+    std::condition_variable wake_;
+    bool stopping_ = false;          // guarded by sleep_mutex_
+
+    std::vector<std::thread> workers_;
+};
+
+/// @brief the executor shared by all readers that are not given one, started on first use
+Executor& default_executor();
+
+/// @brief runs tasks on an executor and waits for all of them. The first exception thrown by a task
+///        is rethrown by wait(). The destructor waits too, so the tasks may use the caller's locals.
+///        The tasks are queued in the group, the executor only gets a handle that runs the oldest of
+///        them, so a thread waiting for the group can run its tasks without ever running the tasks
+///        of other groups (which may take locks the waiting thread holds).
+class TaskGroup {
+public:
+    explicit TaskGroup(Executor& executor);
+    ~TaskGroup();
+
+    TaskGroup(const TaskGroup&) = delete;
+    TaskGroup& operator=(const TaskGroup&) = delete;
+
+    void run(std::function<void()> task);
+
+    /// @brief runs the oldest task of this group that has not started yet on the calling thread
+    /// @return false when there is none
+    bool run_pending_task();
+
+    /// @brief blocks until every task finished, running queued tasks of this group meanwhile
+    void wait();
+
+private:
+    // shared with the handles on the executor, which may run after the group is gone
+    struct State {
+        std::mutex mutex;
+        std::condition_variable changed;          // a task finished or was queued
+        std::deque<std::function<void()>> queued; // guarded by mutex
+        size_t pending = 0;                       // queued or running, guarded by mutex
+        std::exception_ptr error;                 // guarded by mutex
+    };
+
+    static bool run_next(State& state);
+
+    Executor& executor_;
+    std::shared_ptr<State> state_;
+};
+
+}
\ No newline at end of file
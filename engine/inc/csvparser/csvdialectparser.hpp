@@ -0,0 +1,71 @@
+#pragma once
+
+#include <type_traits>
+
+#include <csvdialect.hpp>
+#include "csvsimpleparser.hpp"
+#include "csvquotingparser.hpp"
+#include "csvlenienttable.hpp"
+#include "csvsimd.hpp"
+
+namespace csv {
+
+namespace lenient {
+
+template <typename D>
+inline constexpr CharClassTable DIALECT_CHAR_CLASSES = make_char_classes(D::delimiter, D::quote, D::newline);
+
+}
+
+template <typename D>
+using DialectParserBase = std::conditional_t<!D::has_quoting, SimpleParser,
+                          std::conditional_t<D::parse_mode == Config::ParseMode::strict,
+                                             StrictQuotingParser,
+                                             LenientQuotingParser>>;
+
+/// @brief parser specialized for a compile-time dialect, e.g. DialectParser<Dialect<';'>>.
+///        Runs the same algorithm as the runtime parser of that mode, with delimiter, quote and
+///        line ending folded into the byte loops. Options outside the dialect (kernel, ...) come from config.
+///        With a SIMD kernel (the automatic default) strict mode still builds its structural index at
+///        runtime, the kernel broadcasts delimiter and quote once per window; D is folded into record
+///        assembly from the index and into the byte-loop fallback. Without quoting the SIMD kernels
+///        and memchr are runtime too, so only the scalar kernel runs a fully folded loop.
+template <typename D>
+class DialectParser final : public DialectParserBase<D> {
+public:
+    using dialect = D;
+
+    explicit DialectParser(const Config& config = {})
+        : DialectParserBase<D>(D::apply(config))
+    {
+        const auto kernel = simd::resolve_kernel(config.kernel);
+        if constexpr (!D::has_quoting) {
+            if (kernel != Config::Kernel::scalar) {
+                this->use_kernel(simd::kernel_ops(kernel));
+            }
+        }
+        else if constexpr (D::parse_mode == Config::ParseMode::strict) {
+            this->use_kernel(simd::kernel_ops(kernel));
+        }
+    }
+
+    /// @brief function parse doesn't reset the parser state
+    [[nodiscard]] ParseStatus parse(std::string_view buffer) override {
+        if constexpr (!D::has_quoting) {
+            // delimiters and newlines are already found by memchr or the structural index
+            return DialectParserBase<D>::parse(buffer);
+        }
+        else if constexpr (D::parse_mode == Config::ParseMode::strict) {
+            return this->parse_as(buffer, D{});
+        }
+        else {
+            return this->parse_as(buffer, D{}, lenient::DIALECT_CHAR_CLASSES<D>);
+        }
+    }
+
+    [[nodiscard]] ParseStatus parse_batch(std::string_view buffer, RecordBatch& batch) override {
+        return this->parse_records(buffer, batch, [this](std::string_view data) { return DialectParser::parse(data); });
+    }
+};
+
+}
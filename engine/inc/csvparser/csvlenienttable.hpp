@@ -0,0 +1,76 @@
+#pragma once
+
+#include <array>
+#include <cstdint>
+#include <cstddef>
+
+namespace csv::lenient {
+
+// Character-class x state transition table of the lenient quoting state machine.
+// The whole table is constexpr, the 256-entry class table is generated for the configured
+// delimiter, quote and newline, so the inner loop is two loads per byte instead of a branch tree.
+
+enum CharClass : uint8_t { other, delimiter, newline, quote };
+constexpr size_t CLASS_COUNT = 4;
+
+enum State : uint8_t {
+    field_start,        // nothing read in the field yet, a quote here opens quoting
+    unquoted,           // inside a field, quotes are literal
+    quoted,             // inside quotes, delimiters and newlines are data
+    quote_in_quoted     // saw a quote inside quotes: "" is a literal quote, anything else closed quoting
+};
+constexpr size_t STATE_COUNT = 4;
+
+// transition byte: next state in the low bits, actions above it
+constexpr uint8_t STATE_MASK = 0b11;
+constexpr uint8_t APPEND     = 1 << 2;   // copy the byte into the field
+constexpr uint8_t END_FIELD  = 1 << 3;
+constexpr uint8_t END_RECORD = 1 << 4;
+
+using CharClassTable = std::array<uint8_t, 256>;
+using TransitionTable = std::array<uint8_t, STATE_COUNT * CLASS_COUNT>;
+
+/// @brief newline wins over delimiter wins over quote when they collide, like the byte loops
+constexpr CharClassTable make_char_classes(char delimiter_char, char quote_char, char newline_char) {
+    CharClassTable classes{};
+    classes[static_cast<unsigned char>(quote_char)] = quote;
+    classes[static_cast<unsigned char>(delimiter_char)] = delimiter;
+    classes[static_cast<unsigned char>(newline_char)] = newline;
+    return classes;
+}
+
+constexpr TransitionTable make_transitions() {
+    TransitionTable table{};
+    const auto set = [&](State state, CharClass cls, uint8_t transition) {
+        table[state * CLASS_COUNT + cls] = transition;
+    };
+
+    set(field_start, other,     unquoted | APPEND);
+    set(field_start, delimiter, field_start | END_FIELD);
+    set(field_start, newline,   field_start | END_RECORD);
+    set(field_start, quote,     quoted);
+
+    set(unquoted, other,     unquoted | APPEND);
+    set(unquoted, delimiter, field_start | END_FIELD);
+    set(unquoted, newline,   field_start | END_RECORD);
+    set(unquoted, quote,     unquoted | APPEND);
+
+    set(quoted, other,     quoted | APPEND);
+    set(quoted, delimiter, quoted | APPEND);
+    set(quoted, newline,   quoted | APPEND);
+    set(quoted, quote,     quote_in_quoted);
+
+    set(quote_in_quoted, other,     unquoted | APPEND);
+    set(quote_in_quoted, delimiter, field_start | END_FIELD);
+    set(quote_in_quoted, newline,   field_start | END_RECORD);
+    set(quote_in_quoted, quote,     quoted | APPEND);
+
+    return table;
+}
+
+inline constexpr TransitionTable TRANSITIONS = make_transitions();
+
+static_assert(TRANSITIONS[quoted * CLASS_COUNT + quote] == quote_in_quoted);
+static_assert(make_char_classes(',', '"', '\n')[static_cast<unsigned char>(',')] == delimiter);
+
+}
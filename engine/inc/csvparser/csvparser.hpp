@@ -1,3 +1,5 @@
 #include "csvsimdparser.hpp"
+#include "csvswarparser.hpp"
 #include "csvsimpleparser.hpp"
-#include "csvquotingparser.hpp"
\ No newline at end of file
+#include "csvquotingparser.hpp"
+#include "csvdialectparser.hpp"
\ No newline at end of file
@@ -4,8 +4,10 @@
 #include <vector>
 #include <string_view>
 #include <memory>
+#include <type_traits>
 
 #include <csvconfig.hpp>
+#include <csvrecord/csvrecordbatch.hpp>
 
 namespace csv {
 
@@ -20,6 +22,11 @@ public:
     /// @brief function parse doesn't reset the parser state
     [[nodiscard]] virtual ParseStatus parse(std::string_view buffer) = 0;
 
+    /// @brief parses complete records of buffer into batch until it is full, consumed() covers all of them.
+    ///        A record cut by the end of buffer or failing to parse is left for the next call; when no record
+    ///        was added, returns the status and keeps the state of parse(), so the caller refills as for parse()
+    [[nodiscard]] virtual ParseStatus parse_batch(std::string_view buffer, RecordBatch& batch);
+
     [[nodiscard]] size_t consumed() const noexcept;
     [[nodiscard]] std::string_view err_msg() const noexcept;
     std::vector<FieldType>& fields() noexcept;
@@ -29,6 +36,10 @@ public:
 protected:
     virtual void remove_last_char_from_fields() = 0;
 
+    /// @brief parse_batch() loop, parsers pass their own parse() to call it without virtual dispatch
+    template <typename ParseFn>
+    ParseStatus parse_records(std::string_view buffer, RecordBatch& batch, ParseFn parse_record);
+
     const Config config_;
     std::string err_msg_;
     std::vector<FieldType> fields_;
@@ -57,6 +68,39 @@ struct ParserTypeSelector<std::string_view> {
 template <typename FieldType>
 using Parser = typename ParserTypeSelector<FieldType>::type;
 
+template <typename FieldType>
+template <typename ParseFn>
+ParseStatus ParserBase<FieldType>::parse_records(std::string_view buffer, RecordBatch& batch, ParseFn parse_record) {
+    if constexpr (std::is_same_v<FieldType, std::string_view>) {
+        batch.set_source(buffer);
+    }
+
+    size_t total = 0;
+    size_t added = 0;
+
+    while (!batch.full() && total < buffer.size()) {
+        auto status = parse_record(buffer.substr(total));
+
+        if (status != ParseStatus::complete) {
+            if (added == 0) {
+                return status;
+            }
+            // the next call starts over at this record
+            reset();
+            break;
+        }
+
+        batch.append(fields_);
+        total += consumed_;
+        added++;
+        reset();
+    }
+
+    consumed_ = total;
+    return added ? ParseStatus::complete : ParseStatus::need_more_data;
+}
+
 std::unique_ptr<Parser<std::string>> make_parser(const Config& config);
+std::unique_ptr<Parser<std::string_view>> make_view_parser(const Config& config);
 
 }
\ No newline at end of file
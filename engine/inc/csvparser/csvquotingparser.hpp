@@ -1,6 +1,14 @@
 #pragma once
 
+#include <algorithm>
+#include <memory>
+#include <cstring>
+
+#include <csvdialect.hpp>
 #include "csvparserbase.hpp"
+#include "csvsimd.hpp"
+#include "csvlenienttable.hpp"
+#include "csvstructuralindex.hpp"
 
 namespace csv {
 
@@ -27,9 +35,29 @@ public:
 
     /// @brief function parse doesn't reset the parser state
     [[nodiscard]] ParseStatus parse(std::string_view buffer) override;
+    [[nodiscard]] ParseStatus parse_batch(std::string_view buffer, RecordBatch& batch) override;
 
 protected:
     void remove_last_char_from_fields() override;
+    void use_kernel(const simd::KernelOps& ops) noexcept;
+
+    // when set, runs of ordinary characters are skipped in bulk instead of byte by byte
+    simd::FindFn find_structural_ = nullptr;
+
+    // when set, records that start on a clean state are read from a quote-aware structural index
+    // built once per buffer window
+    std::unique_ptr<StructuralIndex> index_;
+
+    /// @brief parse() for a dialect: RuntimeDialect reads Config, Dialect<...> folds into immediates
+    template <typename D>
+    ParseStatus parse_as(std::string_view buffer, const D& dialect);
+
+private:
+    template <typename D>
+    ParseStatus parse_bytes(std::string_view buffer, const D& dialect);
+    template <typename D>
+    ParseStatus parse_blocks(std::string_view buffer, const D& dialect);
+    bool add_quoted_field(const char* begin, const char* end, char quote);
 };
 
 
@@ -39,9 +67,419 @@ public:
 
     /// @brief function parse doesn't reset the parser state
     [[nodiscard]] ParseStatus parse(std::string_view buffer) override;
+    [[nodiscard]] ParseStatus parse_batch(std::string_view buffer, RecordBatch& batch) override;
+
+protected:
+    void remove_last_char_from_fields() override;
+
+    /// @brief parse() for a dialect, classes must be generated for the same dialect
+    template <typename D>
+    ParseStatus parse_as(std::string_view buffer, const D& dialect, const lenient::CharClassTable& classes);
+
+private:
+    static constexpr size_t MIN_SCRATCH_SIZE = 256;
+
+    const lenient::CharClassTable classes_;
+    std::string scratch_;   // unescaped bytes of the current record before they become fields
+};
+
+
+/// @brief zero-copy quoting parser for ViewReader (strict or lenient, from config.parse_mode).
+///        Fields are views into the buffer, quotes stripped; only fields that need unescaping ("")
+///        are rewritten into a per-record arena, valid until the next parse() or reset().
+///        need_more_data consumes nothing: once the buffer is refilled the record is parsed again
+///        from its start, so quoting state never has to survive compaction.
+class ViewQuotingParser : public QuotingParser<std::string_view> {
+public:
+    explicit ViewQuotingParser(const Config& config, Config::Kernel kernel = Config::Kernel::automatic);
+
+    /// @brief parses one record starting at buffer.data()
+    [[nodiscard]] ParseStatus parse(std::string_view buffer) override;
+    [[nodiscard]] ParseStatus parse_batch(std::string_view buffer, RecordBatch& batch) override;
+
+    void shift_views(const char* buffer_start) override;
+    void reset() noexcept override;
 
 protected:
     void remove_last_char_from_fields() override;
+
+private:
+    bool parse_indexed(std::string_view buffer);
+    bool add_quoted_field(std::string_view raw);
+    ParseStatus parse_copied(std::string_view buffer);
+    bool in_arena(std::string_view field) const noexcept;
+
+    static constexpr size_t MIN_INDEX_WINDOW = 128;
+
+    StructuralIndex index_;
+    size_t index_window_ = StructuralIndex::MAX_WINDOW;   // bytes indexed at a time
+    std::unique_ptr<Parser<std::string>> fallback_;   // records the index cannot serve
+    std::string arena_;
+    const char* record_start_ = nullptr;
 };
 
-}
\ No newline at end of file
+
+// --- templates shared by the runtime and compile-time dialect parsers ---
+
+template <typename D>
+ParseStatus StrictQuotingParser::parse_as(std::string_view buffer, const D& dialect) {
+    // a record continued from the previous buffer carries its state in in_quotes_, pending_quote_
+    // and pending_cr_, which the byte loop already knows how to resume from
+    if (index_ && !incomplete_last_read_ && !pending_quote_ && !pending_cr_) {
+        return parse_blocks(buffer, dialect);
+    }
+    return parse_bytes(buffer, dialect);
+}
+
+// Two-stage parsing:
+//  - stage 1 (StructuralIndex::build) runs once per buffer window and records every delimiter and
+//    newline outside quote regions, quote_regions = prefix_xor(quotes) so "" never ends a region
+//  - stage 2 (here) builds the fields of the next record from those offsets; following calls
+//    continue from the same index as long as the buffer starts where the previous record ended
+// Anything the index cannot decide on its own (record not finished in this window, malformed
+// quoting, CRLF without CR) is re-parsed by the byte loop from the record start, so both paths
+// always produce the same result.
+template <typename D>
+ParseStatus StrictQuotingParser::parse_blocks(std::string_view buffer, const D& dialect) {
+    consumed_ = 0;
+
+    if (buffer.empty()) return ParseStatus::need_more_data;
+
+    const size_t record = index_->find_record(buffer);
+    if (record == std::string_view::npos) {
+        return parse_bytes(buffer, dialect);
+    }
+
+    const size_t fields_before = fields_.size();
+    const size_t field_count = index_->field_count(record);
+
+    for (size_t column = 0; column < field_count; column++) {
+        std::string_view raw = index_->raw_field(record, column);
+
+        if (column + 1 == field_count && dialect.line_ending == Config::LineEnding::crlf) {
+            if (raw.empty() || raw.back() != '\r') {
+                fields_.resize(fields_before);
+                return parse_bytes(buffer, dialect);
+            }
+            raw.remove_suffix(1);
+        }
+
+        if (!index_->field_has_quotes(record, column)) {
+            fields_.emplace_back(raw);
+        }
+        else if (!add_quoted_field(raw.data(), raw.data() + raw.size(), dialect.quote)) {
+            fields_.resize(fields_before);
+            return parse_bytes(buffer, dialect);
+        }
+    }
+
+    consumed_ = index_->record_end(record) - index_->record_begin(record);
+    return ParseStatus::complete;
+}
+
+template <typename D>
+ParseStatus StrictQuotingParser::parse_bytes(std::string_view buffer, const D& dialect) {
+    consumed_ = 0;
+
+    if (buffer.empty()) return ParseStatus::need_more_data;
+
+    const char* buff_it = buffer.data();
+    const char* buff_end = buff_it + buffer.size();
+
+    auto field_start = buff_it;
+    size_t current_field_quote_literals = 0;    
+    const auto is_quote   = [&](char c) { return c == dialect.quote; };
+    const auto is_delim   = [&](char c) { return c == dialect.delimiter; };
+    const auto is_newline = [&](char c) { return c == dialect.newline; };
+
+    const auto is_begin   = [&](auto it) { return it == buffer.data(); };
+    const auto is_end     = [&](auto it) { return it == buff_end; };
+    const auto consume    = [&](size_t consume_size = 1) {
+        buff_it += consume_size;
+        consumed_ += consume_size;
+    };
+    const auto add_field =  [&](auto end_it) {
+        if (!incomplete_last_read_) {
+            fields_.emplace_back();
+        }
+
+        std::string& field_ref = fields_.back();
+        size_t write_start = field_ref.size();
+
+        size_t curr_field_size = std::distance(field_start, end_it) - current_field_quote_literals;
+        field_ref.resize(field_ref.size() + curr_field_size);
+
+        if (current_field_quote_literals == 0) {
+            // explicit char* converion by &*
+            std::memcpy(field_ref.data() + write_start, &*field_start, curr_field_size);
+        }
+        else {
+            auto it = field_start;
+            while (it != end_it) {
+                field_ref[write_start++] = *it++;
+                // for double quotes just skip the next one
+                if (it != end_it && is_quote(*it) && is_quote(*(it-1))) it++;
+            }
+        }
+
+        current_field_quote_literals = 0;
+        incomplete_last_read_ = false;
+    };
+
+    if (dialect.line_ending == Config::LineEnding::crlf && pending_cr_) {
+        pending_cr_ = false;
+        if (!is_newline(*buff_it)) {
+            return ParseStatus::fail;
+        }
+        else {
+            consume();
+            remove_last_char_from_fields();
+            return ParseStatus::complete;
+        }
+    }
+
+    if (pending_quote_) {
+        pending_quote_ = false;
+
+        if (is_quote(*buff_it)) {
+            in_quotes_ = true;
+            consume();
+
+            if (is_end(buff_it)) {
+                incomplete_last_read_ = true;
+                return ParseStatus::need_more_data;
+            }
+        }
+        else if (!is_delim(*buff_it) && !is_newline(*buff_it)) {
+            consume();
+            return ParseStatus::fail;
+        }
+        else if (is_newline(*buff_it)) {
+            consume();
+            return ParseStatus::complete;
+        }
+        else if (is_delim(*buff_it)) {
+            consume(); // we already have the field so we can just skip delim to avoid adding new field
+            field_start = buff_it;
+            incomplete_last_read_ = false;
+        }
+    }
+
+    while (!is_end(buff_it)) {
+        if (is_newline(*buff_it) && !in_quotes_) {
+            auto field_end = buff_it;
+            if (dialect.line_ending == Config::LineEnding::crlf) {
+                if (!is_begin(field_end) && *(field_end-1) == '\r') {
+                    field_end--;
+                }
+                else {
+                    return ParseStatus::fail;
+                }
+            }
+            add_field(field_end);
+            consume();
+            return ParseStatus::complete;
+        }
+        
+        if (is_delim(*buff_it) && !in_quotes_) {
+            add_field(buff_it);
+            consume();
+            field_start = buff_it;
+            continue;
+        }
+        
+        if (is_quote(*buff_it)) {
+            auto next_buff_it = buff_it + 1;
+
+            // double quote => literal
+            if (in_quotes_ && !is_end(next_buff_it) && is_quote(*next_buff_it)) {
+                consume(2); // skip one char to make literal
+                current_field_quote_literals++;
+                continue;
+            }
+            // one quote => quoting
+            else if (in_quotes_) {
+                in_quotes_ = false;
+
+                if (!is_end(next_buff_it)) {
+                    bool is_next_delim = is_delim(*next_buff_it);
+                    bool is_next_newline = is_newline(*next_buff_it);
+
+                    if (dialect.line_ending == Config::LineEnding::crlf && *next_buff_it == '\r') {
+                        if (!is_end((buff_it+2))) {
+                            // if we have \r\n after quoting then just add field and complete
+                            if (is_newline(*(buff_it+2))) {
+                                add_field(buff_it);
+                                consume(3);
+                                return ParseStatus::complete;
+                            }
+                            return ParseStatus::fail;
+                        }
+                        else {
+                            add_field(buff_it);
+                            consume(2);
+                            fields_.back().push_back('\r');
+                            pending_cr_ = true;
+                            pending_quote_ = true;
+                            return ParseStatus::need_more_data;
+                        }
+                    }
+
+                    // wrong quoting => data after quotes
+                    if (!is_next_delim && !is_next_newline) {
+                        return ParseStatus::fail;
+                    }
+                    
+                    // for delim or newline as next char
+                    add_field(buff_it);
+                    consume(2);
+                    field_start = buff_it;
+
+                    if (is_next_delim) {
+                        continue;
+                    }
+
+                    if (is_next_newline) {
+                        return ParseStatus::complete;
+                    }
+                }
+                // end, so we need to mark field as incomplete and show that the last char was quote
+                // if the first character of the next buffer will be also quote then we will have just literal
+                else {
+                    // Quote at buffer end
+                    add_field(buff_it);  // Add field without closing quote
+                    pending_quote_ = true;
+                    incomplete_last_read_ = true;
+                    consume();
+                    return ParseStatus::need_more_data;
+                }
+            }
+            else if (buff_it == field_start) {
+                in_quotes_ = true;
+                field_start = buff_it + 1; // skip open quote in field
+            }
+            else {
+                return ParseStatus::fail;
+            }
+        }
+        // skip every other character 
+        if (find_structural_) {
+            const char* next = find_structural_(buff_it + 1, buff_end, dialect.delimiter, dialect.newline, dialect.quote);
+            consume(static_cast<size_t>(next - buff_it));
+            continue;
+        }
+        consume();
+    }
+
+    if (dialect.line_ending == Config::LineEnding::crlf && !in_quotes_ &&
+        !buffer.empty() && buffer.back() == '\r')
+    {
+        pending_cr_ = true;
+    }
+
+    add_field(buff_it);
+    incomplete_last_read_ = true;
+
+    return ParseStatus::need_more_data;
+}
+
+// Every byte goes through classes and lenient::TRANSITIONS: the byte is written to scratch_
+// unconditionally and the write position advances only when the transition says APPEND,
+// so quotes are dropped without a branch. Only field and record ends leave the loop body.
+// Quoting state that spans buffers is kept in in_quotes_ / pending_quote_ (quote_in_quoted).
+template <typename D>
+ParseStatus LenientQuotingParser::parse_as(std::string_view buffer, const D& dialect, const lenient::CharClassTable& classes) {
+    consumed_ = 0;
+
+    if (buffer.empty()) return ParseStatus::need_more_data;
+
+    const char* buff_it = buffer.data();
+    const char* buff_end = buff_it + buffer.size();
+    const bool crlf = dialect.line_ending == Config::LineEnding::crlf;
+
+    if (crlf && pending_cr_) {
+        pending_cr_ = false;
+        if (*buff_it == dialect.newline) {
+            consumed_ = 1;
+            remove_last_char_from_fields();
+            return ParseStatus::complete;
+        }
+        // in other case just treat \r as data
+    }
+
+    // scratch_ grows with the record, not the buffer, which may be a whole mapped file
+    char* out = scratch_.data();
+    size_t written = 0;
+    size_t field_out = 0;
+
+    // the first field continues the last one of the previous buffer
+    bool merge_field = incomplete_last_read_ && !fields_.empty();
+    const auto add_field = [&]() {
+        std::string_view content(out + field_out, written - field_out);
+        if (merge_field) {
+            fields_.back() += content;
+            merge_field = false;
+        }
+        else {
+            fields_.emplace_back(content);
+        }
+        field_out = written;
+    };
+
+    // an unquoted field continued from the previous buffer is in field_start only while still empty,
+    // so a quote at the start of this buffer is literal once the field has data
+    uint8_t state = pending_quote_ ? lenient::quote_in_quoted
+                  : in_quotes_     ? lenient::quoted
+                  : merge_field && !fields_.back().empty() ? lenient::unquoted
+                  :                  lenient::field_start;
+    pending_quote_ = false;
+
+    while (buff_it != buff_end) {
+        if (written == scratch_.size()) {
+            scratch_.resize(std::max<size_t>(2 * scratch_.size(), MIN_SCRATCH_SIZE));
+            out = scratch_.data();
+        }
+        // every byte writes at most one byte, so the loop below cannot run past scratch_
+        const char* chunk_end = buff_it + std::min<size_t>(buff_end - buff_it, scratch_.size() - written);
+
+        for (; buff_it != chunk_end; buff_it++) {
+            const char c = *buff_it;
+            const uint8_t transition = lenient::TRANSITIONS[state * lenient::CLASS_COUNT + classes[static_cast<unsigned char>(c)]];
+
+            out[written] = c;
+            written += (transition & lenient::APPEND) >> 2;
+
+            if (transition & (lenient::END_FIELD | lenient::END_RECORD)) [[unlikely]] {
+                if (transition & lenient::END_RECORD) {
+                    // unquoted bytes were all appended, so a CR right before the newline is the last one written
+                    if (crlf && state == lenient::unquoted && buff_it != buffer.data() && *(buff_it - 1) == '\r') {
+                        written--;
+                    }
+                    add_field();
+                    in_quotes_ = false;
+                    incomplete_last_read_ = false;
+                    consumed_ = static_cast<size_t>(buff_it - buffer.data()) + 1;
+                    return ParseStatus::complete;
+                }
+                add_field();
+            }
+
+            state = transition & lenient::STATE_MASK;
+        }
+    }
+
+    in_quotes_ = state == lenient::quoted;
+    pending_quote_ = state == lenient::quote_in_quoted;
+
+    if (crlf && !in_quotes_ && buffer.back() == '\r') {
+        pending_cr_ = true;
+    }
+
+    add_field();
+    incomplete_last_read_ = true;
+    consumed_ = buffer.size();
+
+    return ParseStatus::need_more_data;
+}
+
+}
@@ -0,0 +1,78 @@
+#pragma once
+
+#include <cstdint>
+#include <cstddef>
+#include <optional>
+#include <string_view>
+#include <vector>
+
+#include <csvconfig.hpp>
+
+namespace csv::simd {
+
+constexpr size_t BLOCK_SIZE = 64;
+
+// environment variable that overrides Config::Kernel::automatic, e.g. CSVENGINE_KERNEL=swar
+constexpr const char* KERNEL_ENV_VAR = "CSVENGINE_KERNEL";
+
+/// @brief one bit per byte of a 64-byte block, bit i set when byte i matches
+struct StructuralMasks {
+    uint64_t delimiter = 0;
+    uint64_t newline = 0;
+    uint64_t quote = 0;
+};
+
+/// @brief classifies exactly BLOCK_SIZE bytes starting at block
+using ScanFn = StructuralMasks (*)(const char* block, char delimiter, char newline, char quote) noexcept;
+
+/// @brief returns the first delimiter, newline or quote in [begin, end), or end when there is none
+using FindFn = const char* (*)(const char* begin, const char* end, char delimiter, char newline, char quote) noexcept;
+
+/// @brief bit i of the result is the XOR of bits 0..i, turns a quote mask into quoted regions
+using PrefixXorFn = uint64_t (*)(uint64_t mask) noexcept;
+
+/// @brief entry points of one compiled kernel
+struct KernelOps {
+    Config::Kernel kernel;
+    ScanFn scan;
+    FindFn find;            // nullptr for the scalar kernel, which keeps the byte-by-byte loops
+    PrefixXorFn prefix_xor;
+};
+
+StructuralMasks scan_scalar(const char* block, char delimiter, char newline, char quote) noexcept;
+StructuralMasks scan_swar(const char* block, char delimiter, char newline, char quote) noexcept;
+StructuralMasks scan_sse42(const char* block, char delimiter, char newline, char quote) noexcept;
+StructuralMasks scan_avx2(const char* block, char delimiter, char newline, char quote) noexcept;
+StructuralMasks scan_avx512(const char* block, char delimiter, char newline, char quote) noexcept;
+
+const char* find_structural_swar(const char* begin, const char* end, char delimiter, char newline, char quote) noexcept;
+const char* find_structural_sse42(const char* begin, const char* end, char delimiter, char newline, char quote) noexcept;
+const char* find_structural_avx2(const char* begin, const char* end, char delimiter, char newline, char quote) noexcept;
+const char* find_structural_avx512(const char* begin, const char* end, char delimiter, char newline, char quote) noexcept;
+
+uint64_t prefix_xor_shift(uint64_t mask) noexcept;
+uint64_t prefix_xor_clmul(uint64_t mask) noexcept;
+
+/// @brief true when the kernel is compiled in and the running CPU supports it
+bool supported(Config::Kernel kernel) noexcept;
+bool avx2_supported() noexcept;
+
+/// @brief fastest kernel supported by the running CPU, detected once per process
+Config::Kernel best_kernel() noexcept;
+
+/// @brief maps a requested kernel to one that can run here:
+///        automatic -> CSVENGINE_KERNEL when set, otherwise best_kernel();
+///        unsupported kernels degrade to the next slower supported one
+Config::Kernel resolve_kernel(Config::Kernel requested) noexcept;
+
+const KernelOps& kernel_ops(Config::Kernel kernel) noexcept;
+
+std::string_view kernel_name(Config::Kernel kernel) noexcept;
+std::optional<Config::Kernel> parse_kernel(std::string_view name) noexcept;
+
+/// @brief splits buffer into fields up to the first newline, using scan to find structural characters
+/// @return position of the newline or std::string_view::npos when the buffer ends inside a record
+size_t tokenize(ScanFn scan, std::string_view buffer, char delimiter, char newline,
+                std::vector<std::string_view>& fields);
+
+}
@@ -1,15 +1,29 @@
 #pragma once
 
-#include "csvparserbase.hpp"
+#include "csvsimpleparser.hpp"
+#include "csvquotingparser.hpp"
+#include "csvsimd.hpp"
 
 namespace csv {
 
-class SimdParser : public Parser<std::string> {
+/// @brief SimpleParser that finds delimiters and newlines 64 bytes at a time with vector bitmasks
+class SimdParser : public SimpleParser {
 public:
-    explicit SimdParser(const Config& config);
+    /// @param kernel vector kernel to use, degraded to a supported one on older CPUs
+    explicit SimdParser(const Config& config, Config::Kernel kernel = Config::Kernel::avx2);
+};
+
 
-    /// @brief function parse doesn't reset the parser state
-    [[nodiscard]] ParseStatus parse(std::string_view buffer) override;
+class ViewSimdParser : public ViewSimpleParser {
+public:
+    explicit ViewSimdParser(const Config& config, Config::Kernel kernel = Config::Kernel::avx2);
+};
+
+
+/// @brief StrictQuotingParser that skips runs of ordinary characters with vector compares
+class SimdStrictQuotingParser : public StrictQuotingParser {
+public:
+    explicit SimdStrictQuotingParser(const Config& config, Config::Kernel kernel = Config::Kernel::avx2);
 };
 
-}
\ No newline at end of file
+}
@@ -1,6 +1,9 @@
 #pragma once
 
+#include <memory>
+
 #include "csvparserbase.hpp"
+#include "csvstructuralindex.hpp"
 
 namespace csv {
 
@@ -9,23 +12,37 @@ class SimpleParserBase : public Parser<FieldType> {
 public:
     /// @brief function parse doesn't reset the parser state
     [[nodiscard]] ParseStatus parse(std::string_view buffer) override;
+    [[nodiscard]] ParseStatus parse_batch(std::string_view buffer, RecordBatch& batch) override;
 
 protected:
     explicit SimpleParserBase(const Config& config);
 
     void insert_fields(const std::vector<std::string_view>& fields);
-    std::vector<std::string_view> split(std::string_view str, const char delim) const;
+    void split(std::string_view str, const char delim, std::vector<std::string_view>& fields) const;
     virtual bool has_fields() const = 0;
 
+    /// @brief switches tokenize from memchr to a structural index built by the kernel,
+    ///        records the index cannot serve (incomplete ones) are scanned one by one
+    void use_kernel(const simd::KernelOps& ops);
+
+    /// @brief splits buffer into fields up to the first newline
+    /// @return position of the newline or std::string_view::npos when there is none
+    virtual size_t tokenize(std::string_view buffer, const char newline, std::vector<std::string_view>& fields);
+
     virtual void merge_incomplete_field(const std::string_view& field) = 0;
     virtual void add_field(const std::string_view& field) = 0;
+
+private:
+    std::vector<std::string_view> tokens_;
+    std::unique_ptr<StructuralIndex> index_;
+    simd::ScanFn scan_ = nullptr;
 };
 
 class SimpleParser : public SimpleParserBase<std::string> {
 public:
     explicit SimpleParser(const Config& config);
 
-private:
+protected:
     void merge_incomplete_field(const std::string_view& field) override;
     void add_field(const std::string_view& field) override;
     void remove_last_char_from_fields() override;
@@ -0,0 +1,69 @@
+#pragma once
+
+#include <cstdint>
+#include <cstddef>
+#include <string_view>
+#include <vector>
+
+#include <csvconfig.hpp>
+#include "csvsimd.hpp"
+
+namespace csv {
+
+/// @brief Stage 1 of two-stage parsing: positions of every field end (delimiter) and record end (newline)
+///        outside quotes in a window of bytes, stored as compact uint32 offsets.
+///        Stage 2 (parsers, row counting, projection, skipping) reads fields from the offsets without
+///        looking at the bytes between them again.
+class StructuralIndex {
+public:
+    // offsets are 32-bit, one flag bit marks fields that contain a quote character
+    static constexpr size_t MAX_WINDOW = size_t{1} << 20;
+    static constexpr uint32_t QUOTED_FLAG = uint32_t{1} << 31;
+
+    /// @param quote_aware when false quotes are ordinary data (has_quoting = false)
+    StructuralIndex(const Config& config, const simd::KernelOps& ops, bool quote_aware);
+
+    /// @brief stage 1: indexes the complete records at the start of window (at most MAX_WINDOW bytes)
+    void build(std::string_view window);
+    void clear() noexcept;
+
+    /// @brief returns the record starting at buffer.data() when buffer continues the indexed window
+    ///        (the previous record was consumed), otherwise rebuilds the index over buffer first
+    /// @return record number or std::string_view::npos when no complete record starts the buffer
+    size_t find_record(std::string_view buffer);
+
+    std::string_view window() const noexcept;
+    size_t record_count() const noexcept;
+    size_t field_count(size_t record) const noexcept;
+
+    /// @brief byte offsets in window: first byte of the record and one past its newline
+    size_t record_begin(size_t record) const noexcept;
+    size_t record_end(size_t record) const noexcept;
+    size_t indexed_bytes() const noexcept;
+
+    /// @brief raw field bytes, quotes and escapes included (and the CR of CRLF for the last field)
+    std::string_view raw_field(size_t record, size_t column) const noexcept;
+    bool field_has_quotes(size_t record, size_t column) const noexcept;
+
+    /// @brief replaces fields with the raw fields of the record
+    void record_fields(size_t record, std::vector<std::string_view>& fields) const;
+
+    const std::vector<uint32_t>& offsets() const noexcept;
+
+private:
+    size_t first_offset(size_t record) const noexcept;
+
+    simd::ScanFn scan_;
+    simd::PrefixXorFn prefix_xor_;
+    const char delimiter_;
+    const char newline_;
+    const char quote_;
+    const bool quote_aware_;
+
+    std::string_view window_;
+    std::vector<uint32_t> offsets_;   // field ends, QUOTED_FLAG when the field contains a quote
+    std::vector<uint32_t> records_;   // index into offsets_ of every record end
+    size_t next_record_ = 0;
+};
+
+}
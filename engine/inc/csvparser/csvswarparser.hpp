@@ -0,0 +1,28 @@
+#pragma once
+
+#include "csvsimpleparser.hpp"
+#include "csvquotingparser.hpp"
+#include "csvsimd.hpp"
+
+namespace csv {
+
+/// @brief SimpleParser that finds delimiters and newlines 8 bytes at a time inside a uint64_t (no vector unit needed)
+class SwarParser : public SimpleParser {
+public:
+    explicit SwarParser(const Config& config);
+};
+
+
+class ViewSwarParser : public ViewSimpleParser {
+public:
+    explicit ViewSwarParser(const Config& config);
+};
+
+
+/// @brief StrictQuotingParser that skips runs of ordinary characters 8 bytes at a time
+class SwarStrictQuotingParser : public StrictQuotingParser {
+public:
+    explicit SwarStrictQuotingParser(const Config& config);
+};
+
+}
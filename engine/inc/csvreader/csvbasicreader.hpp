@@ -0,0 +1,97 @@
+#pragma once
+
+#include <concepts>
+#include <type_traits>
+
+#include <csvreader/csvreader.hpp>
+#include <csvreader/csvreadloop.hpp>
+#include <csvbuffer/csvstreambuffer.hpp>
+#include <csvparser/csvparser.hpp>
+
+namespace csv {
+
+template <typename ParserT>
+using parser_field_t = typename std::remove_cvref_t<decltype(std::declval<ParserT&>().fields())>::value_type;
+
+/// @brief Reader with its buffer and parser types fixed at compile time, e.g.
+///        BasicReader<StreamBuffer<>, DialectParser<Rfc4180Dialect>>. The per-record calls to them
+///        bind statically instead of going through IBuffer / Parser<...>, which Reader and ViewReader keep.
+///        BufferT and ParserT must be the exact types of the objects, the parser is built from config.
+///        Records are Record for string parsers and RecordView for view parsers.
+template <typename BufferT, typename ParserT>
+    requires std::derived_from<BufferT, IBuffer>
+class BasicReader final : public ReaderBase<RecordBase<parser_field_t<ParserT>>> {
+public:
+    using buffer_type = BufferT;
+    using parser_type = ParserT;
+    using record_type = RecordBase<parser_field_t<ParserT>>;
+
+    explicit BasicReader(std::unique_ptr<BufferT> buffer, const Config& config = {})
+        : ReaderBase<record_type>(std::move(buffer), config)
+        , typed_buffer_(static_cast<BufferT*>(this->buffer_.get()))
+        , parser_(config)
+    {
+        this->init();
+    }
+
+    explicit BasicReader(const std::string& filePath, const Config& config = {})
+        requires std::constructible_from<BufferT, std::string_view>
+        : BasicReader(std::make_unique<BufferT>(filePath), config)
+    {}
+
+    explicit BasicReader(std::unique_ptr<std::istream> stream, const Config& config = {})
+        requires std::constructible_from<BufferT, std::unique_ptr<std::istream>>
+        : BasicReader(std::make_unique<BufferT>(std::move(stream)), config)
+    {}
+
+    BasicReader(const BasicReader&) = delete;
+    BasicReader& operator=(const BasicReader&) = delete;
+
+    [[nodiscard]] bool next() override {
+        DirectBuffer<BufferT> buffer(*typed_buffer_);
+        DirectParser<ParserT> parser(parser_);
+        if (!read_records(buffer, parser, [&](std::string_view data) { return parser.parse(data); })) {
+            return false;
+        }
+
+        auto& fields = parser_.fields();
+        this->count_record(fields.size());
+        this->current_record_.assign(fields);
+        return true;
+    }
+
+    /// @brief same as Reader::next_batch or ViewReader::next_batch, depending on the parser
+    [[nodiscard]] bool next_batch(RecordBatch& batch) {
+        DirectBuffer<BufferT> buffer(*typed_buffer_);
+        DirectParser<ParserT> parser(parser_);
+        auto parse_batch = [&](std::string_view data) { return parser.parse_batch(data, batch); };
+        batch.clear();
+
+        if constexpr (std::is_same_v<parser_field_t<ParserT>, std::string_view>) {
+            if (!read_records(buffer, parser, parse_batch)) {
+                return false;
+            }
+            if (!parser_.fields().empty()) {
+                batch.set_source({});
+                batch.append(parser_.fields());
+            }
+        }
+        else {
+            while (!batch.full() && read_records(buffer, parser, parse_batch)) {
+                if (!parser_.fields().empty()) {
+                    batch.append(parser_.fields());
+                    parser.reset();
+                }
+            }
+        }
+
+        this->count_records(batch);
+        return !batch.empty();
+    }
+
+private:
+    BufferT* typed_buffer_;   // this->buffer_, not downcast on every call
+    ParserT parser_;
+};
+
+}
@@ -0,0 +1,151 @@
+#pragma once
+
+#include <algorithm>
+#include <atomic>
+#include <condition_variable>
+#include <cstddef>
+#include <deque>
+#include <exception>
+#include <mutex>
+#include <numeric>
+#include <vector>
+
+#include <csvexecutor.hpp>
+#include <csvrecord/csvrecordbatch.hpp>
+
+namespace csv::detail {
+
+/// @return number of process() calls that may run at the same time for threads (0: executor.concurrency())
+inline size_t batch_tasks(size_t threads, const Executor& executor) noexcept {
+    return std::max<size_t>(threads == 0 ? executor.concurrency() : threads, 1);
+}
+
+/// @return number of batches in flight for threads: read ahead, waiting or being processed
+inline size_t batch_slots(size_t threads, const Executor& executor) noexcept {
+    return 2 * batch_tasks(threads, executor);
+}
+
+/// @brief reads batches on the calling thread with read_batch(batch) and runs process(batch, slot)
+///        for each of them in tasks on executor, at most batch_tasks(threads) calls at a time.
+///        batch_slots(threads) batches are reused: a slot is refilled only after process() returned
+///        for it, so a batch stays valid while it is processed, and the slot index lets process()
+///        keep per-slot state without locking. With one thread process() runs on the calling thread.
+///        While no slot is free the calling thread runs the queued tasks of this call, never those
+///        of other callers on the same executor.
+///        The first exception of read_batch or process stops the reading and is rethrown here
+///        once the started tasks finished.
+template <typename ReadBatch, typename Process>
+void run_batch_workers(ReadBatch read_batch, Process process, size_t threads, Executor& executor) {
+    const size_t max_tasks = batch_tasks(threads, executor);
+    const size_t slots = batch_slots(threads, executor);
+
+    if (max_tasks == 1) {
+        // one call at a time gains nothing from a task
+        RecordBatch batch;
+        while (read_batch(batch)) {
+            process(static_cast<const RecordBatch&>(batch), size_t{0});
+        }
+        return;
+    }
+
+    std::vector<RecordBatch> batches(slots);
+    std::vector<size_t> free_slots(slots);
+    std::iota(free_slots.begin(), free_slots.end(), size_t{0});
+    std::deque<size_t> filled;      // read, not yet taken by a task
+    size_t running = 0;             // tasks taking filled batches
+
+    std::mutex mutex;
+    std::condition_variable slot_freed;
+    std::atomic<bool> stopping{false};
+    std::exception_ptr error;
+    auto fail = [&](std::exception_ptr e) {
+        std::lock_guard lock(mutex);
+        if (!error) {
+            error = e;
+        }
+        stopping.store(true, std::memory_order_relaxed);
+    };
+
+    // a task processes filled batches until there are none left, so running bounds the calls
+    auto process_filled = [&] {
+        while (true) {
+            size_t slot;
+            {
+                std::lock_guard lock(mutex);
+                if (filled.empty()) {
+                    running--;
+                    return;
+                }
+                slot = filled.front();
+                filled.pop_front();
+            }
+
+            // after a failure the remaining batches are only handed back
+            if (!stopping.load(std::memory_order_relaxed)) {
+                try {
+                    process(static_cast<const RecordBatch&>(batches[slot]), slot);
+                }
+                catch (...) {
+                    fail(std::current_exception());
+                }
+            }
+            {
+                std::lock_guard lock(mutex);
+                free_slots.push_back(slot);
+            }
+            slot_freed.notify_one();
+        }
+    };
+
+    TaskGroup tasks(executor);
+    auto take_slot = [&] {
+        while (true) {
+            {
+                std::lock_guard lock(mutex);
+                if (!free_slots.empty()) {
+                    const size_t slot = free_slots.back();
+                    free_slots.pop_back();
+                    return slot;
+                }
+            }
+            if (tasks.run_pending_task()) {
+                continue;
+            }
+            std::unique_lock lock(mutex);
+            slot_freed.wait(lock, [&] { return !free_slots.empty(); });
+        }
+    };
+
+    try {
+        while (!stopping.load(std::memory_order_relaxed)) {
+            const size_t slot = take_slot();
+            if (!read_batch(batches[slot])) {
+                break;
+            }
+
+            bool start_task = false;
+            {
+                std::lock_guard lock(mutex);
+                filled.push_back(slot);
+                if (running < max_tasks) {
+                    running++;
+                    start_task = true;
+                }
+            }
+            if (start_task) {
+                tasks.run(process_filled);
+            }
+        }
+    }
+    catch (...) {
+        fail(std::current_exception());
+    }
+
+    tasks.wait();
+
+    if (error) {
+        std::rethrow_exception(error);
+    }
+}
+
+}
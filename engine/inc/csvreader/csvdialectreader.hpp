@@ -0,0 +1,28 @@
+#pragma once
+
+#include <csvdialect.hpp>
+#include <csvreader/csvreader.hpp>
+#include <csvparser/csvdialectparser.hpp>
+
+namespace csv {
+
+/// @brief Reader whose parser is specialized for a compile-time dialect.
+///        config keeps the non-dialect options (header, buffer, record size policy, kernel);
+///        its delimiter, quote, line ending and parse mode are replaced by D.
+template <typename D>
+class DialectReader : public Reader {
+public:
+    explicit DialectReader(const std::string& filePath, const Config& config = {})
+        : Reader(filePath, D::apply(config), std::make_unique<DialectParser<D>>(config))
+    {}
+
+    explicit DialectReader(std::unique_ptr<std::istream> stream, const Config& config = {})
+        : Reader(std::move(stream), D::apply(config), std::make_unique<DialectParser<D>>(config))
+    {}
+
+    explicit DialectReader(std::unique_ptr<IBuffer> buffer, const Config& config = {})
+        : Reader(std::move(buffer), D::apply(config), std::make_unique<DialectParser<D>>(config))
+    {}
+};
+
+}
@@ -0,0 +1,98 @@
+#pragma once
+
+#include <atomic>
+#include <condition_variable>
+#include <cstddef>
+#include <exception>
+#include <mutex>
+#include <string>
+#include <string_view>
+#include <vector>
+
+#include <csvexecutor.hpp>
+#include <csvreader/csvreader.hpp>
+#include <csvrecord/csvrecordbatch.hpp>
+
+namespace csv {
+
+/// @brief reads a memory-mapped file on several threads. The data after the header is split into chunks
+///        that end at record boundaries; tasks on an Executor parse the chunks with the parser of a ViewReader
+///        (each chunk read through a MemoryBuffer over the mapping, so nothing is copied), and next() hands
+///        out the records in file order, with line_number() and the record size policy applied as Reader does.
+///        At most 2 * threads chunks are parsed ahead of the caller, which bounds the memory of a fast parse.
+///        Records are views into the mapping or the chunk's batch and are valid until the next call to next().
+///        Chunk boundaries are found in two passes: tasks count the quotes of fixed-size raw chunks,
+///        a prefix XOR of the counts gives the quote state at every raw boundary, and each boundary moves
+///        to the next line ending outside quotes, so quoted fields may contain line breaks (RFC 4180).
+///        Without has_quoting a boundary is just the next line ending. ParseMode::lenient accepts stray quotes
+///        inside unquoted fields, which would misplace a boundary, so lenient quoted input is one chunk.
+///        Compressed files cannot be split, use Reader for them.
+class ParallelReader : public ReaderBase<RecordView> {
+public:
+    static constexpr size_t DEFAULT_CHUNK_SIZE = 4 * 1024 * 1024;
+
+    /// @param threads parallelism, 2 * threads chunks are queued or parsed ahead of the caller, 0 uses executor.concurrency()
+    /// @param chunk_size bytes of data per chunk, a chunk extends to the end of its last record
+    /// @param executor runs the parsing tasks, shared with the other readers by default
+    explicit ParallelReader(const std::string& filePath, const Config& config = {},
+                            size_t threads = 0, size_t chunk_size = DEFAULT_CHUNK_SIZE,
+                            Executor& executor = default_executor());
+    ~ParallelReader();
+
+    // the parsing tasks keep a pointer to this object
+    ParallelReader(const ParallelReader&) = delete;
+    ParallelReader& operator=(const ParallelReader&) = delete;
+    ParallelReader(ParallelReader&&) = delete;
+    ParallelReader& operator=(ParallelReader&&) = delete;
+
+    [[nodiscard]] bool next() override;
+
+    /// @brief replaces batch with the next parsed batch of records (up to RecordBatch::DEFAULT_CAPACITY),
+    ///        current_record() is not changed. Fields are valid while the reader lives.
+    /// @return false when there are no more records or the data could not be parsed
+    [[nodiscard]] bool next_batch(RecordBatch& batch);
+
+    size_t threads() const noexcept;
+    size_t chunk_count() const noexcept;
+
+private:
+    struct Chunk {
+        std::string_view data;
+        std::vector<RecordBatch> batches;
+        std::exception_ptr error;
+        bool failed = false;   // the parser stopped before the end of the chunk
+        bool ready = false;
+    };
+
+    /// @return chunks of data that start and end at record boundaries
+    std::vector<std::string_view> split(std::string_view data, size_t chunk_size) const;
+    void start(size_t threads, size_t chunk_size);
+    /// @brief submits the parsing task of the next chunk, if there is one
+    void submit_next_chunk();
+    void parse_chunk(Chunk& chunk) const;
+
+    /// @return the chunk holding the next batch, nullptr at the end of data
+    Chunk* next_ready_chunk();
+    void release_chunk(size_t index);
+
+    std::unique_ptr<Parser<std::string_view>> header_parser_;
+    bool started_ = false;
+
+    Executor& executor_;
+    size_t threads_ = 0;
+
+    std::vector<Chunk> chunks_;
+    size_t next_to_parse_ = 0;     // next chunk to submit
+    size_t current_chunk_ = 0;     // chunk the caller reads, chunks before it are released
+    size_t current_batch_ = 0;
+    size_t current_row_ = 0;
+    std::vector<std::string_view> fields_;
+
+    size_t max_in_flight_ = 0;
+    std::atomic<bool> stopping_{false};   // tasks that did not start yet skip their chunk
+    std::mutex mutex_;
+    std::condition_variable chunk_ready_;
+    TaskGroup tasks_;
+};
+
+}
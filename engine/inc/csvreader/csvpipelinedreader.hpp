@@ -0,0 +1,76 @@
+#pragma once
+
+#include <cstddef>
+#include <exception>
+#include <istream>
+#include <memory>
+#include <string>
+#include <string_view>
+#include <thread>
+#include <vector>
+
+#include <csvreader/csvreader.hpp>
+#include <csvreader/csvspscqueue.hpp>
+#include <csvrecord/csvrecordbatch.hpp>
+
+namespace csv {
+
+/// @brief reads in three stages on three threads: a ReadAheadBuffer refills the input, a parse thread
+///        turns it into record batches, and the caller iterates them with next() as with ViewReader.
+///        The stages are linked by SpscQueues: parsed batches go to the caller and drained ones come
+///        back to the parse thread, so queue_depth + 1 batches are reused for the whole input.
+///        Unlike ParallelReader it needs no random access, so it also speeds up pipes, stdin and
+///        compressed files. Fields are owned by the current batch and valid until the next call to next().
+class PipelinedReader : public ReaderBase<RecordView> {
+public:
+    static constexpr size_t DEFAULT_QUEUE_DEPTH = 4;
+
+    /// @param queue_depth parsed batches the parse thread may run ahead of the caller
+    explicit PipelinedReader(const std::string& filePath, const Config& config = {}, size_t queue_depth = DEFAULT_QUEUE_DEPTH);
+    explicit PipelinedReader(std::unique_ptr<std::istream> stream, const Config& config = {}, size_t queue_depth = DEFAULT_QUEUE_DEPTH);
+    explicit PipelinedReader(std::unique_ptr<IBuffer> buffer, const Config& config = {}, size_t queue_depth = DEFAULT_QUEUE_DEPTH);
+    ~PipelinedReader();
+
+    // the parse thread keeps a pointer to this object
+    PipelinedReader(const PipelinedReader&) = delete;
+    PipelinedReader& operator=(const PipelinedReader&) = delete;
+    PipelinedReader(PipelinedReader&&) = delete;
+    PipelinedReader& operator=(PipelinedReader&&) = delete;
+
+    [[nodiscard]] bool next() override;
+
+    /// @brief swaps batch with the next parsed batch, the memory of the old one is reused by the parse thread.
+    ///        current_record() is not changed
+    /// @return false when there are no more records or the data could not be parsed
+    [[nodiscard]] bool next_batch(RecordBatch& batch);
+
+    /// @brief false once the input was read to the end, answered without the buffer, which belongs to the parse thread
+    bool good() const noexcept override;
+
+private:
+    void start();
+    void parse_batches() noexcept;
+
+    /// @brief hands the current batch back to the parse thread and takes the next parsed one
+    bool next_parsed_batch();
+
+    std::unique_ptr<Parser<std::string_view>> parser_;
+    bool started_ = false;
+
+    // parse thread
+    RecordBatch parsed_;                 // views into the buffer window
+    std::exception_ptr error_;
+    bool failed_ = false;                // published by closing filled_
+
+    SpscQueue<RecordBatch> filled_;
+    SpscQueue<RecordBatch> free_;
+    std::thread parse_thread_;
+
+    // caller
+    RecordBatch current_;
+    size_t current_row_ = 0;
+    std::vector<std::string_view> fields_;
+    bool done_ = false;
+};
+
+}
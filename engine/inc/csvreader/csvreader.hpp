@@ -10,8 +10,10 @@
 
 #include <csvconfig.hpp>
 #include <csvrecord/csvrecord.hpp>
+#include <csvrecord/csvrecordbatch.hpp>
 #include <csvbuffer/csvbuffer.hpp>
 #include <csvparser/csvparser.hpp>
+#include <csvreader/csvbatchworkers.hpp>
 
 namespace csv {
 
@@ -23,7 +25,7 @@ protected:
     explicit ReaderBase(std::unique_ptr<IBuffer> buffer, const Config& config = {});
 
 public:
-    bool good() const noexcept;
+    virtual bool good() const noexcept;
     bool has_header() const noexcept;
     std::size_t line_number() const noexcept;
     std::size_t record_size() const noexcept;
@@ -61,6 +63,9 @@ protected:
     void validate_config() const;
     void create_buffer(const std::string& filepath);
     size_t expected_record_size(size_t record_size) const noexcept;
+    /// @brief applies the record size policy to a record of field_count fields and counts it
+    void count_record(size_t field_count);
+    void count_records(const RecordBatch& batch);
 
     friend class Iterator;
 
@@ -90,6 +95,30 @@ public:
 
     [[nodiscard]] bool next() override;
 
+    /// @brief replaces batch with up to batch.capacity() next records, current_record() is not changed
+    /// @return false when there are no more records or the data could not be parsed
+    [[nodiscard]] bool next_batch(RecordBatch& batch);
+
+    /// @brief calls fn(RecordBatch::RecordRef) for every remaining record in tasks on executor, at most
+    ///        threads concurrent calls, in no particular order. This thread reads the batches,
+    ///        each stays valid until fn returned for all its records. An exception of fn or of the
+    ///        reader stops the reading and is rethrown after the tasks finished.
+    /// @param threads at most threads concurrent calls of fn (0: executor.concurrency()); with 1, fn runs on
+    ///        this thread. Up to 2 * threads batches are read ahead or processed at a time
+    template <typename Fn>
+    void parallel_for_each(Fn fn, size_t threads = 0, Executor& executor = default_executor());
+
+    /// @brief combine(init, map(record)...) over every remaining record, mapped and combined in tasks
+    ///        on executor in no particular order, so combine must be associative and commutative
+    template <typename T, typename Map, typename Combine>
+    T parallel_reduce(T init, Map map, Combine combine, size_t threads = 0, Executor& executor = default_executor());
+
+protected:
+    // for readers that bring their own parser, e.g. DialectReader
+    Reader(const std::string& filePath, const Config& config, std::unique_ptr<Parser<std::string>> parser);
+    Reader(std::unique_ptr<std::istream> stream, const Config& config, std::unique_ptr<Parser<std::string>> parser);
+    Reader(std::unique_ptr<IBuffer> buffer, const Config& config, std::unique_ptr<Parser<std::string>> parser);
+
 private:
     std::unique_ptr<Parser<std::string>> parser_;
 };
@@ -110,8 +139,127 @@ public:
 
     [[nodiscard]] bool next() override;
 
+    /// @brief replaces batch with the next records of one buffer window, at most batch.capacity() of them.
+    ///        Unescaped fields point into the buffer and are valid until the next read, current_record() is not changed
+    /// @return false when there are no more records or the data could not be parsed
+    [[nodiscard]] bool next_batch(RecordBatch& batch);
+
+    /// @brief calls fn(RecordBatch::RecordRef) for every remaining record in tasks on executor, at most
+    ///        threads concurrent calls, in no particular order. This thread reads the batches and copies
+    ///        the fields out of the buffer window, each batch stays valid until fn returned for all its records. An exception of fn or of the
+    ///        reader stops the reading and is rethrown after the tasks finished.
+    /// @param threads at most threads concurrent calls of fn (0: executor.concurrency()); with 1, fn runs on
+    ///        this thread. Up to 2 * threads batches are read ahead or processed at a time
+    template <typename Fn>
+    void parallel_for_each(Fn fn, size_t threads = 0, Executor& executor = default_executor());
+
+    /// @brief combine(init, map(record)...) over every remaining record, mapped and combined in tasks
+    ///        on executor in no particular order, so combine must be associative and commutative
+    template <typename T, typename Map, typename Combine>
+    T parallel_reduce(T init, Map map, Combine combine, size_t threads = 0, Executor& executor = default_executor());
+
 private:
     std::unique_ptr<Parser<std::string_view>> parser_;
 };
 
+namespace detail {
+
+template <typename T, typename Map, typename Combine>
+class ParallelReduction {
+public:
+    ParallelReduction(T init, Map& map, Combine& combine, size_t slots)
+        : init_(std::move(init)), map_(map), combine_(combine)
+        , partials_(slots)
+    {}
+
+    // each batch slot folds into its own partial result, they are combined once at the end
+    void add(const RecordBatch& batch, size_t slot) {
+        auto& partial = partials_[slot].value;
+        for (size_t i = 0; i < batch.size(); i++) {
+            auto mapped = map_(batch[i]);
+            partial = partial ? combine_(std::move(*partial), std::move(mapped)) : T(std::move(mapped));
+        }
+    }
+
+    T result() {
+        T result = std::move(init_);
+        for (auto& partial : partials_) {
+            if (partial.value) {
+                result = combine_(std::move(result), std::move(*partial.value));
+            }
+        }
+        return result;
+    }
+
+private:
+    // one cache line per slot, the partials are written for every record
+    struct alignas(64) Partial {
+        std::optional<T> value;
+    };
+
+    T init_;
+    Map& map_;
+    Combine& combine_;
+    std::vector<Partial> partials_;
+};
+
+template <typename Fn>
+void for_each_record(const RecordBatch& batch, Fn& fn) {
+    for (size_t i = 0; i < batch.size(); i++) {
+        fn(batch[i]);
+    }
+}
+
+}
+
+template <typename Fn>
+void Reader::parallel_for_each(Fn fn, size_t threads, Executor& executor) {
+    detail::run_batch_workers(
+        [this](RecordBatch& batch) { return next_batch(batch); },
+        [&fn](const RecordBatch& batch, size_t) { detail::for_each_record(batch, fn); },
+        threads, executor);
+}
+
+template <typename T, typename Map, typename Combine>
+T Reader::parallel_reduce(T init, Map map, Combine combine, size_t threads, Executor& executor) {
+    detail::ParallelReduction<T, Map, Combine> reduction(std::move(init), map, combine, detail::batch_slots(threads, executor));
+    detail::run_batch_workers(
+        [this](RecordBatch& batch) { return next_batch(batch); },
+        [&reduction](const RecordBatch& batch, size_t slot) { reduction.add(batch, slot); },
+        threads, executor);
+    return reduction.result();
+}
+
+template <typename Fn>
+void ViewReader::parallel_for_each(Fn fn, size_t threads, Executor& executor) {
+    detail::run_batch_workers(
+        [this, window = RecordBatch()](RecordBatch& batch) mutable {
+            // the views of window are overwritten by the next read, the tasks get a copy
+            if (!next_batch(window)) {
+                return false;
+            }
+            batch.copy_from(window);
+            return true;
+        },
+        [&fn](const RecordBatch& batch, size_t) { detail::for_each_record(batch, fn); },
+        threads, executor);
+}
+
+template <typename T, typename Map, typename Combine>
+T ViewReader::parallel_reduce(T init, Map map, Combine combine, size_t threads, Executor& executor) {
+    detail::ParallelReduction<T, Map, Combine> reduction(std::move(init), map, combine, detail::batch_slots(threads, executor));
+    detail::run_batch_workers(
+        [this, window = RecordBatch()](RecordBatch& batch) mutable {
+            // the views of window are overwritten by the next read, the tasks get a copy
+            if (!next_batch(window)) {
+                return false;
+            }
+            batch.copy_from(window);
+            return true;
+        },
+        [&reduction](const RecordBatch& batch, size_t slot) { reduction.add(batch, slot); },
+        threads, executor);
+    return reduction.result();
+}
+
 }
\ No newline at end of file
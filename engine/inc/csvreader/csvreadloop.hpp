@@ -0,0 +1,142 @@
+#pragma once
+
+#include <concepts>
+#include <string_view>
+
+#include <csverrors.hpp>
+#include <csvbuffer/csvbuffer.hpp>
+#include <csvparser/csvparserbase.hpp>
+
+namespace csv {
+
+/// @brief refills buffer and runs parse until it reports a complete record or batch, or the data ends.
+///        Shared by the type-erased readers (IBuffer, Parser<...>) and BasicReader (DirectBuffer, DirectParser).
+/// @return false at the end of data or on a parse failure; at the end of data an unterminated
+///         last record is left in parser.fields() and true is returned
+template <typename Buffer, typename RecordParser, typename ParseFn>
+bool read_records(Buffer& buffer, RecordParser& parser, ParseFn parse) {
+    parser.reset();
+
+    if constexpr (requires { parser.shift_views(nullptr); }) {
+        bool need_to_compact_data = false;
+        size_t consumed = 0;
+        while (true) {
+            if (buffer.empty() || need_to_compact_data) {
+
+                if (consumed >= buffer.capacity()) {
+                    throw RecordTooLargeError();
+                }
+
+                auto refill_result = buffer.refill();
+
+                if (refill_result == ReadingResult::eof) {
+                    // refill may have compacted the buffer under the last, unterminated record
+                    parser.shift_views(buffer.view().data());
+                    // whatever is left belongs to the last record
+                    buffer.consume(buffer.available());
+                    return !parser.fields().empty();
+                }
+
+                // parsers that restart an incomplete record consume nothing until it is complete
+                if (refill_result == ReadingResult::buffer_full) {
+                    throw RecordTooLargeError();
+                }
+
+                if (refill_result != ReadingResult::ok) {
+                    buffer.consume(parser.consumed());
+                    return false;
+                }
+
+                // in case ParseStatus::need_more_data - adjust fields to the new buffer and then consumed data to move to the next
+                parser.shift_views(buffer.view().data());
+                buffer.consume(parser.consumed());
+                need_to_compact_data = false;
+            }
+
+            auto result = parse(buffer.view());
+            consumed += parser.consumed();
+
+            // if we need more data then we need to refill buffer with moving our data to the beggining
+            if (result == ParseStatus::need_more_data) {
+                need_to_compact_data = true;
+                continue;
+            }
+            else {
+                buffer.consume(parser.consumed());
+            }
+
+            if (result == ParseStatus::complete) {
+                return true;
+            }
+
+            if (result == ParseStatus::fail) {
+                return false;
+            }
+        }
+    }
+    else {
+        while (true) {
+            if (buffer.empty()) {
+                auto refill_result = buffer.refill();
+
+                if (refill_result == ReadingResult::eof) {
+                    return !parser.fields().empty();
+                }
+
+                if (refill_result != ReadingResult::ok) {
+                    return false;
+                }
+            }
+
+            auto result = parse(buffer.view());
+            buffer.consume(parser.consumed());
+
+            if (result == ParseStatus::complete) {
+                return true;
+            }
+
+            if (result == ParseStatus::fail) {
+                return false;
+            }
+        }
+    }
+}
+
+/// @brief forwards to BufferT's own member functions, so the calls bind statically and can inline
+template <typename BufferT>
+class DirectBuffer {
+public:
+    explicit DirectBuffer(BufferT& buffer) noexcept : buffer_(buffer) {}
+
+    ReadingResult refill() { return buffer_.BufferT::refill(); }
+    std::string_view view() const noexcept { return buffer_.BufferT::view(); }
+    void consume(size_t bytes) noexcept { buffer_.BufferT::consume(bytes); }
+    size_t available() const noexcept { return buffer_.BufferT::available(); }
+    size_t capacity() const noexcept { return buffer_.BufferT::capacity(); }
+    bool empty() const noexcept { return buffer_.BufferT::empty(); }
+
+private:
+    BufferT& buffer_;
+};
+
+/// @brief forwards to ParserT's own member functions, so the calls bind statically and can inline
+template <typename ParserT>
+class DirectParser {
+public:
+    explicit DirectParser(ParserT& parser) noexcept : parser_(parser) {}
+
+    ParseStatus parse(std::string_view buffer) { return parser_.ParserT::parse(buffer); }
+    ParseStatus parse_batch(std::string_view buffer, RecordBatch& batch) { return parser_.ParserT::parse_batch(buffer, batch); }
+    void reset() noexcept { parser_.ParserT::reset(); }
+    size_t consumed() const noexcept { return parser_.consumed(); }
+    auto& fields() noexcept { return parser_.fields(); }
+
+    void shift_views(const char* buffer_start) requires std::derived_from<ParserT, ViewParser> {
+        parser_.ParserT::shift_views(buffer_start);
+    }
+
+private:
+    ParserT& parser_;
+};
+
+}
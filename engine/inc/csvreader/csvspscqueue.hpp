@@ -0,0 +1,91 @@
+#pragma once
+
+#include <atomic>
+#include <cstddef>
+#include <utility>
+#include <vector>
+
+namespace csv {
+
+/// @brief bounded queue between exactly one producer thread and one consumer thread.
+///        Each side writes only its own index (tail_ for the producer, head_ for the consumer) and reads
+///        the other with acquire, so push() and pop() take no lock. A full or empty queue blocks with
+///        std::atomic::wait on the other side's index instead of spinning.
+///        The top bit of an index marks its side as closed, which also wakes the other side.
+template <typename T>
+class SpscQueue {
+public:
+    explicit SpscQueue(size_t capacity)
+        : slots_(capacity == 0 ? 1 : capacity)
+    {}
+
+    SpscQueue(const SpscQueue&) = delete;
+    SpscQueue& operator=(const SpscQueue&) = delete;
+
+    /// @brief producer: waits while the queue is full
+    /// @return false when the consumer cancelled the queue, value is not moved then
+    bool push(T&& value) {
+        const size_t tail = tail_.load(std::memory_order_relaxed);
+        size_t head = head_.load(std::memory_order_acquire);
+        while ((tail & ~CLOSED) - (head & ~CLOSED) == slots_.size()) {
+            if (head & CLOSED) {
+                return false;
+            }
+            head_.wait(head, std::memory_order_acquire);
+            head = head_.load(std::memory_order_acquire);
+        }
+        if (head & CLOSED) {
+            return false;
+        }
+
+        slots_[(tail & ~CLOSED) % slots_.size()] = std::move(value);
+        tail_.store(tail + 1, std::memory_order_release);
+        tail_.notify_one();
+        return true;
+    }
+
+    /// @brief consumer: waits while the queue is empty
+    /// @return false when the queue is empty and the producer closed it
+    bool pop(T& value) {
+        const size_t head = head_.load(std::memory_order_relaxed);
+        size_t tail = tail_.load(std::memory_order_acquire);
+        while ((tail & ~CLOSED) == (head & ~CLOSED)) {
+            if (tail & CLOSED) {
+                return false;
+            }
+            tail_.wait(tail, std::memory_order_acquire);
+            tail = tail_.load(std::memory_order_acquire);
+        }
+
+        value = std::move(slots_[(head & ~CLOSED) % slots_.size()]);
+        head_.store(head + 1, std::memory_order_release);
+        head_.notify_one();
+        return true;
+    }
+
+    /// @brief producer: no more values, pop() returns false once the queue is drained
+    void close() noexcept {
+        tail_.fetch_or(CLOSED, std::memory_order_release);
+        tail_.notify_all();
+    }
+
+    /// @brief consumer: no more values are taken, push() returns false from now on
+    void cancel() noexcept {
+        head_.fetch_or(CLOSED, std::memory_order_release);
+        head_.notify_all();
+    }
+
+    size_t capacity() const noexcept {
+        return slots_.size();
+    }
+
+private:
+    static constexpr size_t CLOSED = size_t(1) << (sizeof(size_t) * 8 - 1);
+    static constexpr size_t CACHE_LINE = 64;
+
+    std::vector<T> slots_;
+    alignas(CACHE_LINE) std::atomic<size_t> head_{0};   // next slot to pop, written by the consumer
+    alignas(CACHE_LINE) std::atomic<size_t> tail_{0};   // next slot to push, written by the producer
+};
+
+}
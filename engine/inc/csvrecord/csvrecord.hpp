@@ -42,6 +42,12 @@ public:
             init_headers(headers);
         }
     
+    /// @brief replaces the fields, reusing the storage of the previous ones (readers call it for every record)
+    template <typename OtherFieldType>
+    void assign(const std::vector<OtherFieldType>& fields) {
+        fields_.assign(fields.begin(), fields.end());
+    }
+
     void init_headers(const std::vector<std::string>& headers) {
         for(size_t i = 0; i < headers.size(); i++) {
             headers_[headers[i]] = i;
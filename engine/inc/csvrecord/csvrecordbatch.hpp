@@ -0,0 +1,162 @@
+#pragma once
+
+#include <string>
+#include <string_view>
+#include <vector>
+#include <stdexcept>
+
+namespace csv {
+
+/// @brief up to capacity() records kept as flat arrays: each field is an offset and a length,
+///        each record is the range of fields ending at record_ends_[i].
+///        Field bytes are either copied into the batch or, for a batch of views, referenced in the
+///        source buffer set by set_source(); those stay valid until the reader reads again.
+class RecordBatch {
+public:
+    static constexpr size_t DEFAULT_CAPACITY = 1024;
+
+    /// @brief lightweight view of one record of the batch, valid until the batch is cleared
+    class RecordRef {
+    public:
+        RecordRef(const RecordBatch* batch, size_t first_field, size_t end_field) noexcept
+            : batch_(batch), first_(first_field), end_(end_field) {}
+
+        size_t size() const noexcept {
+            return end_ - first_;
+        }
+
+        bool empty() const noexcept {
+            return first_ == end_;
+        }
+
+        std::string_view operator[](size_t index) const noexcept {
+            return batch_->field(first_ + index);
+        }
+
+        std::string_view at(size_t index) const {
+            if (index >= size()) {
+                throw std::out_of_range("Field index out of range");
+            }
+            return operator[](index);
+        }
+
+        std::vector<std::string_view> fields() const {
+            std::vector<std::string_view> result;
+            result.reserve(size());
+            for (size_t i = first_; i < end_; i++) {
+                result.push_back(batch_->field(i));
+            }
+            return result;
+        }
+
+    private:
+        const RecordBatch* batch_;
+        size_t first_;
+        size_t end_;
+    };
+
+    explicit RecordBatch(size_t capacity = DEFAULT_CAPACITY)
+        : capacity_(capacity == 0 ? 1 : capacity)
+    {
+        record_ends_.reserve(capacity_);
+    }
+
+    size_t size() const noexcept {
+        return record_ends_.size();
+    }
+
+    size_t capacity() const noexcept {
+        return capacity_;
+    }
+
+    bool empty() const noexcept {
+        return record_ends_.empty();
+    }
+
+    bool full() const noexcept {
+        return record_ends_.size() >= capacity_;
+    }
+
+    /// @brief number of fields of all records
+    size_t field_count() const noexcept {
+        return lengths_.size();
+    }
+
+    RecordRef operator[](size_t record) const noexcept {
+        return RecordRef(this, record == 0 ? 0 : record_ends_[record - 1], record_ends_[record]);
+    }
+
+    RecordRef at(size_t record) const {
+        if (record >= size()) {
+            throw std::out_of_range("Record index out of range");
+        }
+        return operator[](record);
+    }
+
+    /// @brief field by its index among all fields of the batch
+    std::string_view field(size_t index) const noexcept {
+        const size_t offset = offsets_[index];
+        const char* base = (offset & OWNED) ? data_.data() : source_.data();
+        return std::string_view(base + (offset & ~OWNED), lengths_[index]);
+    }
+
+    void clear() noexcept {
+        data_.clear();
+        offsets_.clear();
+        lengths_.clear();
+        record_ends_.clear();
+        source_ = {};
+    }
+
+    /// @brief fields inside source are referenced instead of copied by the following appends,
+    ///        all referenced fields of the batch must come from the same source
+    void set_source(std::string_view source) noexcept {
+        source_ = source;
+    }
+
+    template <typename FieldType>
+    void append(const std::vector<FieldType>& fields) {
+        for (const auto& field : fields) {
+            add_field(field);
+        }
+        record_ends_.push_back(lengths_.size());
+    }
+
+    /// @brief replaces the batch with a copy of other that owns all its field bytes,
+    ///        reusing the memory the batch already has
+    void copy_from(const RecordBatch& other) {
+        clear();
+        for (size_t i = 0; i < other.field_count(); i++) {
+            const auto field = other.field(i);
+            offsets_.push_back(data_.size() | OWNED);
+            data_.append(field);
+            lengths_.push_back(field.size());
+        }
+        record_ends_.assign(other.record_ends_.begin(), other.record_ends_.end());
+    }
+
+private:
+    // set on offsets into data_, clear on offsets into source_
+    static constexpr size_t OWNED = size_t(1) << (sizeof(size_t) * 8 - 1);
+
+    void add_field(std::string_view field) {
+        const char* source_begin = source_.data();
+        if (!source_.empty() && field.data() >= source_begin && field.data() + field.size() <= source_begin + source_.size()) {
+            offsets_.push_back(static_cast<size_t>(field.data() - source_begin));
+        }
+        else {
+            offsets_.push_back(data_.size() | OWNED);
+            data_.append(field);
+        }
+        lengths_.push_back(field.size());
+    }
+
+    size_t capacity_;
+    std::string data_;
+    std::string_view source_;
+    std::vector<size_t> offsets_;
+    std::vector<size_t> lengths_;
+    std::vector<size_t> record_ends_;
+};
+
+}
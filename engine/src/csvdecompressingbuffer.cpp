@@ -0,0 +1,325 @@
+#include <csvbuffer/csvdecompressingbuffer.hpp>
+#include <csvbuffer/csvstreambuffer.hpp>
+#include <algorithm>
+#include <climits>
+#include <cstring>
+#include <string>
+
+#ifdef CSVENGINE_HAS_ZLIB
+#include <zlib.h>
+#endif
+
+#ifdef CSVENGINE_HAS_ZSTD
+#include <zstd.h>
+#endif
+
+namespace csv {
+
+namespace {
+
+constexpr unsigned char GZIP_MAGIC[] = {0x1f, 0x8b};
+constexpr unsigned char ZSTD_MAGIC[] = {0x28, 0xb5, 0x2f, 0xfd};
+
+template <size_t N>
+bool starts_with(std::string_view data, const unsigned char (&magic)[N]) noexcept {
+    return data.size() >= N && std::memcmp(data.data(), magic, N) == 0;
+}
+
+std::unique_ptr<IBuffer> open_input(std::unique_ptr<std::istream> stream) {
+    if (!stream) {
+        throw FileStreamError();
+    }
+    return make_stream_buffer<DecompressingBuffer::INPUT_CHUNK_SIZE>(std::move(stream));
+}
+
+}
+
+Compression detect_compression(std::string_view data) noexcept {
+    if (starts_with(data, GZIP_MAGIC)) return Compression::gzip;
+    if (starts_with(data, ZSTD_MAGIC)) return Compression::zstd;
+    return Compression::none;
+}
+
+/// @brief inflates as much of input into [output, output_end) as fits, advancing both
+class DecompressingBuffer::Decoder {
+    public:
+        enum class Status { ok, error };
+
+        virtual ~Decoder() = default;
+        virtual Status decode(std::string_view& input, char*& output, char* output_end) = 0;
+        /// @return true between two members / frames, where the compressed data may end
+        virtual bool at_boundary() const noexcept = 0;
+        virtual void reset() = 0;
+};
+
+namespace {
+
+class CopyDecoder : public DecompressingBuffer::Decoder {
+    public:
+        Status decode(std::string_view& input, char*& output, char* output_end) override {
+            const size_t bytes = std::min(input.size(), static_cast<size_t>(output_end - output));
+            std::memcpy(output, input.data(), bytes);
+            input.remove_prefix(bytes);
+            output += bytes;
+            return Status::ok;
+        }
+
+        bool at_boundary() const noexcept override { return true; }
+        void reset() override {}
+};
+
+#ifdef CSVENGINE_HAS_ZLIB
+class GzipDecoder : public DecompressingBuffer::Decoder {
+    public:
+        GzipDecoder() {
+            // 16 + MAX_WBITS: gzip header and trailer only
+            if (inflateInit2(&stream_, 16 + MAX_WBITS) != Z_OK) {
+                throw DecompressionError("Could not initialize gzip decompression");
+            }
+        }
+
+        ~GzipDecoder() override {
+            inflateEnd(&stream_);
+        }
+
+        Status decode(std::string_view& input, char*& output, char* output_end) override {
+            // zero padding after the last member (a file written in fixed-size blocks) is ignored, as gzip does
+            if (!in_member_ && input.front() == '\0') {
+                input.remove_prefix(std::min(input.find_first_not_of('\0'), input.size()));
+                return Status::ok;
+            }
+
+            stream_.next_in = reinterpret_cast<Bytef*>(const_cast<char*>(input.data()));
+            stream_.avail_in = static_cast<uInt>(std::min<size_t>(input.size(), UINT_MAX));
+            stream_.next_out = reinterpret_cast<Bytef*>(output);
+            stream_.avail_out = static_cast<uInt>(std::min<size_t>(output_end - output, UINT_MAX));
+
+            const int result = inflate(&stream_, Z_NO_FLUSH);
+
+            const size_t consumed = static_cast<size_t>(reinterpret_cast<const char*>(stream_.next_in) - input.data());
+            input.remove_prefix(consumed);
+            output = reinterpret_cast<char*>(stream_.next_out);
+
+            if (result == Z_STREAM_END) {
+                // the next member, if any, starts with a new header
+                inflateReset(&stream_);
+                in_member_ = false;
+                return Status::ok;
+            }
+            if (result == Z_OK || result == Z_BUF_ERROR) {
+                in_member_ = in_member_ || consumed > 0;
+                return Status::ok;
+            }
+            return Status::error;
+        }
+
+        bool at_boundary() const noexcept override { return !in_member_; }
+
+        void reset() override {
+            inflateReset(&stream_);
+            in_member_ = false;
+        }
+
+    private:
+        z_stream stream_{};
+        bool in_member_ = false;
+};
+#endif
+
+#ifdef CSVENGINE_HAS_ZSTD
+class ZstdDecoder : public DecompressingBuffer::Decoder {
+    public:
+        ZstdDecoder() : stream_(ZSTD_createDStream()) {
+            if (!stream_ || ZSTD_isError(ZSTD_initDStream(stream_))) {
+                ZSTD_freeDStream(stream_);
+                throw DecompressionError("Could not initialize zstd decompression");
+            }
+        }
+
+        ~ZstdDecoder() override {
+            ZSTD_freeDStream(stream_);
+        }
+
+        Status decode(std::string_view& input, char*& output, char* output_end) override {
+            ZSTD_inBuffer in{input.data(), input.size(), 0};
+            ZSTD_outBuffer out{output, static_cast<size_t>(output_end - output), 0};
+
+            const size_t result = ZSTD_decompressStream(stream_, &out, &in);
+            if (ZSTD_isError(result)) {
+                return Status::error;
+            }
+
+            input.remove_prefix(in.pos);
+            output += out.pos;
+            // 0 once a frame is decoded and flushed completely
+            in_frame_ = result != 0;
+            return Status::ok;
+        }
+
+        bool at_boundary() const noexcept override { return !in_frame_; }
+
+        void reset() override {
+            ZSTD_initDStream(stream_);
+            in_frame_ = false;
+        }
+
+    private:
+        ZSTD_DStream* stream_;
+        bool in_frame_ = false;
+};
+#endif
+
+std::unique_ptr<DecompressingBuffer::Decoder> make_decoder(Compression compression) {
+    switch (compression) {
+        case Compression::gzip:
+#ifdef CSVENGINE_HAS_ZLIB
+            return std::make_unique<GzipDecoder>();
+#else
+            throw DecompressionError("gzip input, but csvengine was built without zlib");
+#endif
+        case Compression::zstd:
+#ifdef CSVENGINE_HAS_ZSTD
+            return std::make_unique<ZstdDecoder>();
+#else
+            throw DecompressionError("zstd input, but csvengine was built without libzstd");
+#endif
+        default:
+            return std::make_unique<CopyDecoder>();
+    }
+}
+
+}
+
+DecompressingBuffer::DecompressingBuffer(std::string_view filename, size_t window_size)
+    : DecompressingBuffer(make_stream_buffer<INPUT_CHUNK_SIZE>(filename), window_size)
+{
+}
+
+DecompressingBuffer::DecompressingBuffer(std::unique_ptr<std::istream> stream, size_t window_size)
+    : DecompressingBuffer(open_input(std::move(stream)), window_size)
+{
+}
+
+DecompressingBuffer::DecompressingBuffer(std::unique_ptr<IBuffer> source, size_t window_size)
+    : source_(std::move(source))
+    , window_size_(std::max<size_t>(window_size, 1))
+    , data_(std::make_unique_for_overwrite<char[]>(window_size_))
+{
+    if (!source_) {
+        throw BufferError();
+    }
+
+    // the first refill carries the magic bytes, it is decoded like any other
+    if (source_->empty()) {
+        source_->refill();
+    }
+    compression_ = detect_compression(source_->view());
+    decoder_ = make_decoder(compression_);
+}
+
+DecompressingBuffer::~DecompressingBuffer() = default;
+DecompressingBuffer::DecompressingBuffer(DecompressingBuffer&&) noexcept = default;
+DecompressingBuffer& DecompressingBuffer::operator=(DecompressingBuffer&&) noexcept = default;
+
+ReadingResult DecompressingBuffer::refill() {
+    if (failed_) {
+        return ReadingResult::fail;
+    }
+
+    compact_window(data_.get(), start_, size_);
+
+    if (size_ == window_size_) {
+        return ReadingResult::buffer_full;
+    }
+
+    char* output = data_.get() + size_;
+    char* const output_end = data_.get() + window_size_;
+
+    while (output < output_end && !finished_) {
+        if (source_->empty()) {
+            const auto result = source_->refill();
+            if (result != ReadingResult::ok) {
+                // a source that stops inside a member or frame is truncated
+                finished_ = true;
+                failed_ = result != ReadingResult::eof || !decoder_->at_boundary();
+                break;
+            }
+        }
+
+        std::string_view input = source_->view();
+        const char* const output_before = output;
+        const size_t input_before = input.size();
+
+        if (decoder_->decode(input, output, output_end) == Decoder::Status::error ||
+            (output == output_before && input.size() == input_before)) {
+            finished_ = true;
+            failed_ = true;
+            break;
+        }
+
+        source_->consume(input_before - input.size());
+    }
+
+    const size_t decoded = static_cast<size_t>(output - (data_.get() + size_));
+    size_ += decoded;
+
+    if (decoded > 0) {
+        return ReadingResult::ok;
+    }
+    return failed_ ? ReadingResult::fail : ReadingResult::eof;
+}
+
+std::string_view DecompressingBuffer::view() const noexcept {
+    return {data_.get() + start_, available()};
+}
+
+void DecompressingBuffer::consume(size_t bytes) noexcept {
+    start_ += std::min(bytes, available());
+}
+
+size_t DecompressingBuffer::available() const noexcept {
+    return size_ - start_;
+}
+
+size_t DecompressingBuffer::capacity() const noexcept {
+    return window_size_;
+}
+
+bool DecompressingBuffer::empty() const noexcept {
+    return start_ == size_;
+}
+
+bool DecompressingBuffer::eof() const noexcept {
+    return empty() && finished_ && !failed_;
+}
+
+bool DecompressingBuffer::good() const noexcept {
+    return !failed_ && !(finished_ && empty());
+}
+
+bool DecompressingBuffer::reset() {
+    if (!source_->reset()) {
+        return false;
+    }
+
+    decoder_->reset();
+    start_ = 0;
+    size_ = 0;
+    finished_ = false;
+    failed_ = false;
+    return true;
+}
+
+void DecompressingBuffer::interrupt() noexcept {
+    source_->interrupt();
+}
+
+bool DecompressingBuffer::may_block() const noexcept {
+    return source_->may_block();
+}
+
+Compression DecompressingBuffer::compression() const noexcept {
+    return compression_;
+}
+
+}
@@ -0,0 +1,196 @@
+#include <csvexecutor.hpp>
+#include <algorithm>
+
+namespace csv {
+
+namespace {
+
+// the worker running on this thread, so that its submits and helping go to its own deque
+thread_local const WorkStealingExecutor* current_executor = nullptr;
+thread_local size_t current_worker = 0;
+
+}
+
+WorkStealingExecutor::WorkStealingExecutor(size_t threads) {
+    if (threads == 0) {
+        threads = std::max(1u, std::thread::hardware_concurrency());
+    }
+
+    for (size_t i = 0; i < threads; i++) {
+        queues_.push_back(std::make_unique<Queue>());
+    }
+
+    workers_.reserve(threads);
+    for (size_t i = 0; i < threads; i++) {
+        workers_.emplace_back([this, i] { work(i); });
+    }
+}
+
+WorkStealingExecutor::~WorkStealingExecutor() {
+    {
+        std::lock_guard lock(sleep_mutex_);
+        stopping_ = true;
+    }
+    wake_.notify_all();
+
+    for (auto& worker : workers_) {
+        worker.join();
+    }
+}
+
+void WorkStealingExecutor::submit(std::function<void()> task) {
+    const size_t index = current_executor == this
+        ? current_worker
+        : next_queue_.fetch_add(1, std::memory_order_relaxed) % queues_.size();
+
+    {
+        std::lock_guard lock(queues_[index]->mutex);
+        queues_[index]->tasks.push_back(std::move(task));
+    }
+    queued_.fetch_add(1, std::memory_order_release);
+
+    // a worker checks queued_ under sleep_mutex_ before it sleeps, so the wake up is not lost
+    {
+        std::lock_guard lock(sleep_mutex_);
+    }
+    wake_.notify_one();
+}
+
+size_t WorkStealingExecutor::concurrency() const noexcept {
+    return workers_.size();
+}
+
+bool WorkStealingExecutor::take_task(size_t index, std::function<void()>& task) {
+    {
+        Queue& own = *queues_[index];
+        std::lock_guard lock(own.mutex);
+        if (!own.tasks.empty()) {
+            task = std::move(own.tasks.back());
+            own.tasks.pop_back();
+            queued_.fetch_sub(1, std::memory_order_relaxed);
+            return true;
+        }
+    }
+
+    for (size_t i = 1; i < queues_.size(); i++) {
+        Queue& victim = *queues_[(index + i) % queues_.size()];
+        std::lock_guard lock(victim.mutex);
+        if (!victim.tasks.empty()) {
+            task = std::move(victim.tasks.front());
+            victim.tasks.pop_front();
+            queued_.fetch_sub(1, std::memory_order_relaxed);
+            return true;
+        }
+    }
+    return false;
+}
+
+void WorkStealingExecutor::work(size_t index) noexcept {
+    current_executor = this;
+    current_worker = index;
+
+    while (true) {
+        std::function<void()> task;
+        if (take_task(index, task)) {
+            task();
+            continue;
+        }
+
+        std::unique_lock lock(sleep_mutex_);
+        wake_.wait(lock, [this] { return stopping_ || queued_.load(std::memory_order_acquire) > 0; });
+        if (stopping_ && queued_.load(std::memory_order_acquire) == 0) {
+            return;
+        }
+    }
+}
+
+Executor& default_executor() {
+    static WorkStealingExecutor executor;
+    return executor;
+}
+
+TaskGroup::TaskGroup(Executor& executor)
+    : executor_(executor)
+    , state_(std::make_shared<State>())
+{}
+
+TaskGroup::~TaskGroup() {
+    try {
+        wait();
+    }
+    catch (...) {
+        // the owner did not wait, its tasks are done but their error is dropped
+    }
+}
+
+void TaskGroup::run(std::function<void()> task) {
+    {
+        std::lock_guard lock(state_->mutex);
+        state_->queued.push_back(std::move(task));
+        state_->pending++;
+    }
+    state_->changed.notify_all();
+
+    // a handle finds the queue empty when the waiting owner already ran the task
+    executor_.submit([state = state_] { run_next(*state); });
+}
+
+bool TaskGroup::run_pending_task() {
+    return run_next(*state_);
+}
+
+bool TaskGroup::run_next(State& state) {
+    std::function<void()> task;
+    {
+        std::lock_guard lock(state.mutex);
+        if (state.queued.empty()) {
+            return false;
+        }
+        task = std::move(state.queued.front());
+        state.queued.pop_front();
+    }
+
+    std::exception_ptr error;
+    try {
+        task();
+    }
+    catch (...) {
+        error = std::current_exception();
+    }
+
+    // notified under the lock: once pending is 0 the waiting owner may destroy the group
+    std::lock_guard lock(state.mutex);
+    if (error && !state.error) {
+        state.error = error;
+    }
+    if (--state.pending == 0) {
+        state.changed.notify_all();
+    }
+    return true;
+}
+
+void TaskGroup::wait() {
+    while (true) {
+        if (run_pending_task()) {
+            continue;
+        }
+
+        // the remaining tasks run on the executor
+        std::unique_lock lock(state_->mutex);
+        state_->changed.wait(lock, [this] { return state_->pending == 0 || !state_->queued.empty(); });
+        if (state_->pending == 0) {
+            break;
+        }
+    }
+
+    std::exception_ptr error;
+    {
+        std::lock_guard lock(state_->mutex);
+        std::swap(error, state_->error);
+    }
+    if (error) {
+        std::rethrow_exception(error);
+    }
+}
+
+}
@@ -0,0 +1,255 @@
+#include <csvbuffer/csvfdbuffer.hpp>
+#include <algorithm>
+#include <cerrno>
+#include <cstring>
+#include <string>
+#include <new>
+
+#include <sys/types.h>
+#include <sys/stat.h>
+#include <sys/eventfd.h>
+#include <fcntl.h>
+#include <poll.h>
+#include <unistd.h>
+
+namespace csv {
+
+namespace {
+
+size_t align_up(size_t value, size_t alignment) {
+    return (value + alignment - 1) / alignment * alignment;
+}
+
+}
+
+FdBuffer::FdBuffer(std::string_view filename, size_t capacity, bool direct_io)
+    : direct_(direct_io)
+    , capacity_(direct_io ? std::max(align_up(capacity, DIRECT_IO_ALIGNMENT), 2 * DIRECT_IO_ALIGNMENT)
+                          : std::max<size_t>(capacity, 1))
+    , data_(allocate_window(capacity_))
+{
+    std::string safe_name(filename);
+
+    fd_ = open(safe_name.c_str(), O_RDONLY | O_CLOEXEC | (direct_ ? O_DIRECT : 0));
+    if (fd_ == -1 && direct_ && errno == EINVAL) {
+        // e.g. tmpfs has no direct I/O
+        direct_ = false;
+        fd_ = open(safe_name.c_str(), O_RDONLY | O_CLOEXEC);
+    }
+    if (fd_ == -1) {
+        throw FileStreamError(filename);
+    }
+
+    // the page cache is bypassed with O_DIRECT, nothing to advise
+    if (!direct_) {
+        posix_fadvise(fd_, 0, 0, POSIX_FADV_SEQUENTIAL);
+        posix_fadvise(fd_, 0, 0, POSIX_FADV_NOREUSE);
+    }
+
+    // e.g. a FIFO given by name
+    watch_interrupts();
+}
+
+FdBuffer::FdBuffer(int fd, size_t capacity)
+    : fd_(fd)
+    , owns_fd_(false)
+    , capacity_(std::max<size_t>(capacity, 1))
+    , data_(allocate_window(capacity_))
+{
+    if (fd_ < 0 || fcntl(fd_, F_GETFL) == -1) {
+        throw FileStreamError();
+    }
+
+    watch_interrupts();
+}
+
+FdBuffer::~FdBuffer() {
+    if (fd_ >= 0 && owns_fd_) {
+        close(fd_);
+    }
+    if (interrupt_fd_ >= 0) {
+        close(interrupt_fd_);
+    }
+}
+
+std::unique_ptr<char, FdBuffer::FreeDeleter> FdBuffer::allocate_window(size_t capacity) {
+    std::unique_ptr<char, FreeDeleter> data(static_cast<char*>(std::aligned_alloc(DIRECT_IO_ALIGNMENT, align_up(capacity, DIRECT_IO_ALIGNMENT))));
+    if (!data) {
+        throw std::bad_alloc();
+    }
+    return data;
+}
+
+FdBuffer::FdBuffer(FdBuffer&& other) noexcept {
+    *this = std::move(other);
+}
+
+FdBuffer& FdBuffer::operator=(FdBuffer&& other) noexcept {
+    if (this != &other) {
+        if (fd_ >= 0 && owns_fd_) close(fd_);
+        if (interrupt_fd_ >= 0) close(interrupt_fd_);
+
+        fd_ = other.fd_;
+        owns_fd_ = other.owns_fd_;
+        interrupt_fd_ = other.interrupt_fd_;
+        direct_ = other.direct_;
+        eof_ = other.eof_;
+        failed_ = other.failed_;
+        capacity_ = other.capacity_;
+        data_ = std::move(other.data_);
+        start_ = other.start_;
+        size_ = other.size_;
+
+        other.fd_ = -1;
+        other.interrupt_fd_ = -1;
+        other.start_ = 0;
+        other.size_ = 0;
+    }
+    return *this;
+}
+
+void FdBuffer::watch_interrupts() {
+    struct stat st;
+    if (fstat(fd_, &st) == 0 && S_ISREG(st.st_mode)) {
+        return;
+    }
+
+    interrupt_fd_ = eventfd(0, EFD_CLOEXEC | EFD_NONBLOCK);
+    if (interrupt_fd_ == -1) {
+        if (owns_fd_) close(fd_);
+        throw FileStreamError();
+    }
+}
+
+// false when interrupted or the poll failed
+bool FdBuffer::wait_readable() noexcept {
+    pollfd fds[2] = {{fd_, POLLIN, 0}, {interrupt_fd_, POLLIN, 0}};
+    while (true) {
+        if (poll(fds, 2, -1) >= 0) {
+            return !(fds[1].revents & POLLIN);
+        }
+        if (errno != EINTR) {
+            return false;
+        }
+    }
+}
+
+bool FdBuffer::drop_direct_io() noexcept {
+    const int flags = fcntl(fd_, F_GETFL);
+    if (flags == -1 || fcntl(fd_, F_SETFL, flags & ~O_DIRECT) == -1) {
+        return false;
+    }
+    direct_ = false;
+    return true;
+}
+
+ReadingResult FdBuffer::refill() {
+    if (fd_ < 0 || failed_) {
+        return ReadingResult::fail;
+    }
+
+    // O_DIRECT reads into an aligned address, the leftover goes right before it
+    const size_t leftover = available();
+    compact_window(data_.get(), start_, size_, direct_ ? align_up(leftover, DIRECT_IO_ALIGNMENT) - leftover : 0);
+
+    if (size_ >= capacity_) {
+        return ReadingResult::buffer_full;
+    }
+
+    // POLLHUP of a closed pipe counts as readable, read() then reports the end
+    if (interrupt_fd_ >= 0 && !wait_readable()) {
+        failed_ = true;
+        return ReadingResult::fail;
+    }
+
+    ssize_t bytes_read;
+    while (true) {
+        bytes_read = read(fd_, data_.get() + size_, capacity_ - size_);
+        if (bytes_read >= 0) {
+            break;
+        }
+        if (errno == EINTR) {
+            continue;
+        }
+        // the file system accepted O_DIRECT at open but not this read, e.g. at an unaligned end of file
+        if (errno == EINVAL && direct_ && drop_direct_io()) {
+            continue;
+        }
+        failed_ = true;
+        return ReadingResult::fail;
+    }
+
+    if (bytes_read == 0) {
+        eof_ = true;
+        return ReadingResult::eof;
+    }
+
+    size_ += static_cast<size_t>(bytes_read);
+    return ReadingResult::ok;
+}
+
+std::string_view FdBuffer::view() const noexcept {
+    if (!data_) return {};
+    return {data_.get() + start_, available()};
+}
+
+void FdBuffer::consume(size_t bytes) noexcept {
+    start_ += std::min(bytes, available());
+}
+
+size_t FdBuffer::available() const noexcept {
+    return size_ - start_;
+}
+
+size_t FdBuffer::capacity() const noexcept {
+    return capacity_;
+}
+
+bool FdBuffer::empty() const noexcept {
+    return start_ == size_;
+}
+
+bool FdBuffer::eof() const noexcept {
+    return empty() && eof_;
+}
+
+bool FdBuffer::good() const noexcept {
+    return fd_ >= 0 && !failed_ && !eof();
+}
+
+bool FdBuffer::reset() {
+    if (interrupt_fd_ >= 0) {
+        eventfd_t count;
+        (void)eventfd_read(interrupt_fd_, &count);
+    }
+
+    if (fd_ < 0 || lseek(fd_, 0, SEEK_SET) == -1) {
+        return false;
+    }
+
+    eof_ = false;
+    failed_ = false;
+    start_ = 0;
+    size_ = 0;
+    return true;
+}
+
+bool FdBuffer::direct() const noexcept {
+    return direct_;
+}
+
+void FdBuffer::interrupt() noexcept {
+    if (interrupt_fd_ >= 0) {
+        (void)eventfd_write(interrupt_fd_, 1);
+    }
+}
+
+bool FdBuffer::may_block() const noexcept {
+    return interrupt_fd_ >= 0;
+}
+
+int FdBuffer::fd() const noexcept {
+    return fd_;
+}
+
+}
@@ -0,0 +1,129 @@
+#include <csvbuffer/csvgrowablestreambuffer.hpp>
+#include <algorithm>
+#include <cstring>
+#include <fstream>
+#include <string>
+
+namespace csv {
+
+namespace {
+
+std::unique_ptr<std::istream> open_file(std::string_view filename) {
+    auto stream = std::make_unique<std::ifstream>(std::string(filename), std::ios::binary);
+    if (!stream->good()) {
+        throw FileStreamError(filename);
+    }
+    return stream;
+}
+
+}
+
+GrowableStreamBuffer::GrowableStreamBuffer(std::string_view filename, size_t capacity, size_t max_capacity)
+    : GrowableStreamBuffer(open_file(filename), capacity, max_capacity)
+{
+}
+
+GrowableStreamBuffer::GrowableStreamBuffer(std::unique_ptr<std::istream> stream, size_t capacity, size_t max_capacity)
+    : stream_(std::move(stream))
+    , initial_capacity_(std::max<size_t>(capacity, 1))
+    , max_capacity_(max_capacity == UNLIMITED ? UNLIMITED : std::max(max_capacity, initial_capacity_))
+    , capacity_(initial_capacity_)
+    , data_(std::make_unique_for_overwrite<char[]>(capacity_))
+{
+    if (!stream_ || !stream_->good()) {
+        throw FileStreamError();
+    }
+}
+
+void GrowableStreamBuffer::resize(size_t new_capacity) {
+    auto data = std::make_unique_for_overwrite<char[]>(new_capacity);
+    const size_t leftover = available();
+    std::memcpy(data.get(), data_.get() + start_, leftover);
+
+    data_ = std::move(data);
+    capacity_ = new_capacity;
+    start_ = 0;
+    size_ = leftover;
+}
+
+ReadingResult GrowableStreamBuffer::refill() {
+    // the outlier record is gone, go back to the normal window while at least half of it stays free
+    if (capacity_ > initial_capacity_ && available() <= initial_capacity_ / 2) {
+        resize(initial_capacity_);
+    }
+    else {
+        compact_window(data_.get(), start_, size_);
+    }
+
+    if (size_ == capacity_) {
+        if (max_capacity_ != UNLIMITED && capacity_ >= max_capacity_) {
+            return ReadingResult::buffer_full;
+        }
+
+        size_t grown = capacity_ * 2;
+        if (max_capacity_ != UNLIMITED) {
+            grown = std::min(grown, max_capacity_);
+        }
+        resize(grown);
+    }
+
+    stream_->read(data_.get() + size_, static_cast<std::streamsize>(capacity_ - size_));
+
+    size_t bytes_read = static_cast<size_t>(stream_->gcount());
+
+    if (bytes_read == 0)
+        return stream_->eof() ? ReadingResult::eof : ReadingResult::fail;
+
+    size_ += bytes_read;
+
+    return ReadingResult::ok;
+}
+
+std::string_view GrowableStreamBuffer::view() const noexcept {
+    return {data_.get() + start_, available()};
+}
+
+void GrowableStreamBuffer::consume(size_t bytes) noexcept {
+    start_ += std::min(bytes, available());
+}
+
+size_t GrowableStreamBuffer::available() const noexcept {
+    return size_ - start_;
+}
+
+size_t GrowableStreamBuffer::capacity() const noexcept {
+    return capacity_;
+}
+
+bool GrowableStreamBuffer::empty() const noexcept {
+    return start_ == size_;
+}
+
+bool GrowableStreamBuffer::eof() const noexcept {
+    return available() == 0 && stream_->eof();
+}
+
+bool GrowableStreamBuffer::good() const noexcept {
+    return stream_->good() || !empty();
+}
+
+bool GrowableStreamBuffer::reset() {
+    stream_->clear();
+    stream_->seekg(0);
+    start_ = 0;
+    size_ = 0;
+    if (capacity_ != initial_capacity_) {
+        resize(initial_capacity_);
+    }
+    return stream_->good();
+}
+
+size_t GrowableStreamBuffer::initial_capacity() const noexcept {
+    return initial_capacity_;
+}
+
+size_t GrowableStreamBuffer::max_capacity() const noexcept {
+    return max_capacity_;
+}
+
+}
@@ -11,7 +11,18 @@
 
 namespace csv {
 
-MappedBuffer::MappedBuffer(std::string_view filename) {
+namespace {
+
+size_t page_size() {
+    static const size_t size = static_cast<size_t>(sysconf(_SC_PAGESIZE));
+    return size;
+}
+
+}
+
+MappedBuffer::MappedBuffer(std::string_view filename, size_t window_size, MappingOptions options)
+    : options_(options)
+{
     std::string safe_name(filename);
 
     int fd = open(safe_name.c_str(), O_RDONLY);
@@ -25,29 +36,41 @@ MappedBuffer::MappedBuffer(std::string_view filename) {
         throw std::runtime_error("Could not get the file size.");
     }
 
-    size_ = static_cast<size_t>(stat_buff.st_size);
+    file_size_ = static_cast<size_t>(stat_buff.st_size);
 
-    if (size_ == 0) {
+    if (file_size_ == 0) {
         close(fd);
         data_ = nullptr;
         return;
     }
 
-    void* addr = mmap(nullptr, size_, PROT_READ, MAP_PRIVATE, fd, 0);
-    close(fd);
+    // at least two pages, so a leftover starting in the first page still gets new data
+    if (window_size != WHOLE_FILE) {
+        window_size_ = std::max(2 * page_size(), (window_size + page_size() - 1) / page_size() * page_size());
+    }
+
+    // a window smaller than the file needs the descriptor for the next ones
+    const bool windowed = window_size_ != WHOLE_FILE && window_size_ < file_size_;
+    fd_ = fd;
+    const bool mapped = map_window(0);
 
-    if (addr == MAP_FAILED) {
-        throw std::runtime_error("File memory mapping failed.");
+    if (!windowed) {
+        close(fd_);
+        fd_ = -1;
     }
 
-    madvise(addr, size_, MADV_SEQUENTIAL);
+    if (!mapped) {
+        if (fd_ >= 0) close(fd_);
+        throw std::runtime_error("File memory mapping failed.");
+    }
 
-    data_ = static_cast<char*>(addr);
+    prefetch();
 }
 
 MappedBuffer::~MappedBuffer() {
-    if (data_) {
-        munmap(data_, size_);
+    unmap();
+    if (fd_ >= 0) {
+        close(fd_);
     }
 }
 
@@ -57,12 +80,21 @@ MappedBuffer::MappedBuffer(MappedBuffer&& other) noexcept {
 
 MappedBuffer& MappedBuffer::operator=(MappedBuffer&& other) noexcept {
     if (this != &other) {
-        if (data_) munmap(data_, size_);
-
+        unmap();
+        if (fd_ >= 0) close(fd_);
+
+        fd_ = other.fd_;
+        file_size_ = other.file_size_;
+        window_size_ = other.window_size_;
+        window_offset_ = other.window_offset_;
+        options_ = other.options_;
+        prefetched_ = other.prefetched_;
+        prefetch_mark_ = other.prefetch_mark_;
         start_ = other.start_;
         size_ = other.size_;
         data_ = other.data_;
 
+        other.fd_ = -1;
         other.data_ = nullptr;
         other.size_ = 0;
         other.start_ = 0;
@@ -70,13 +102,78 @@ MappedBuffer& MappedBuffer::operator=(MappedBuffer&& other) noexcept {
     return *this;
 }
 
+bool MappedBuffer::map_window(size_t offset) noexcept {
+    const size_t length = window_size_ == WHOLE_FILE ? file_size_ : std::min(window_size_, file_size_ - offset);
+
+    const int flags = MAP_PRIVATE | (options_.populate ? MAP_POPULATE : 0);
+    void* addr = mmap(nullptr, length, PROT_READ, flags, fd_, static_cast<off_t>(offset));
+    if (addr == MAP_FAILED) {
+        return false;
+    }
+
+    madvise(addr, length, MADV_SEQUENTIAL);
+#ifdef MADV_HUGEPAGE
+    if (options_.huge_pages) {
+        madvise(addr, length, MADV_HUGEPAGE);
+    }
+#endif
+
+    // the consumed window leaves the resident set here
+    unmap();
+    data_ = static_cast<char*>(addr);
+    window_offset_ = offset;
+    size_ = length;
+    prefetched_ = 0;
+    return true;
+}
+
+// MADV_WILLNEED only starts the reads, the pages arrive while the parser works on the ones before them
+void MappedBuffer::prefetch() noexcept {
+    if (options_.prefetch == 0 || !data_) {
+        prefetch_mark_ = SIZE_MAX;
+        return;
+    }
+
+    const size_t end = start_ + std::min(options_.prefetch, size_ - start_);
+    if (end > prefetched_) {
+        const size_t from = prefetched_ / page_size() * page_size();
+        madvise(data_ + from, end - from, MADV_WILLNEED);
+        prefetched_ = end;
+    }
+
+    // advise the next range once half of this one is consumed
+    prefetch_mark_ = prefetched_ < size_ ? start_ + options_.prefetch / 2 : SIZE_MAX;
+}
+
+void MappedBuffer::unmap() noexcept {
+    if (data_) {
+        munmap(data_, size_);
+        data_ = nullptr;
+    }
+}
+
 ReadingResult MappedBuffer::refill() {
     if (!data_) return ReadingResult::fail;
 
-    if (start_ >= size_) {
+    const size_t window_end = window_offset_ + size_;
+    if (window_end >= file_size_) {
+        // the rest of the file is already in view
         return ReadingResult::eof;
     }
 
+    // map the next window from the page holding the unconsumed data
+    const size_t position = window_offset_ + start_;
+    const size_t offset = position / page_size() * page_size();
+    if (std::min(offset + window_size_, file_size_) <= window_end) {
+        return ReadingResult::buffer_full;
+    }
+
+    if (!map_window(offset)) {
+        return ReadingResult::fail;
+    }
+
+    start_ = position - offset;
+    prefetch();
     return ReadingResult::ok;
 }
 
@@ -87,6 +184,9 @@ std::string_view MappedBuffer::view() const noexcept {
 
 void MappedBuffer::consume(size_t bytes) noexcept {
     start_ += std::min(bytes, available());
+    if (start_ >= prefetch_mark_) {
+        prefetch();
+    }
 }
 
 size_t MappedBuffer::available() const noexcept {
@@ -94,7 +194,7 @@ size_t MappedBuffer::available() const noexcept {
 }
 
 size_t MappedBuffer::capacity() const noexcept {
-    return size_;
+    return window_size_ == WHOLE_FILE ? size_ : window_size_;
 }
 
 bool MappedBuffer::empty() const noexcept {
@@ -102,7 +202,7 @@ bool MappedBuffer::empty() const noexcept {
 }
 
 bool MappedBuffer::eof() const noexcept {
-    return empty();
+    return empty() && window_offset_ + size_ >= file_size_;
 }
 
 bool MappedBuffer::good() const noexcept {
@@ -110,8 +210,17 @@ bool MappedBuffer::good() const noexcept {
 }
 
 bool MappedBuffer::reset() {
+    if (!data_) {
+        return false;
+    }
+
+    if (window_offset_ != 0 && !map_window(0)) {
+        return false;
+    }
+
     start_ = 0;
-    return (data_ != nullptr);
+    prefetch();
+    return true;
 }
 
 }
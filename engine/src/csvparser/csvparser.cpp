@@ -19,6 +19,11 @@ void ParserBase<FieldType>::reset() noexcept {
     err_msg_.clear();
 }
 
+template <typename FieldType>
+ParseStatus ParserBase<FieldType>::parse_batch(std::string_view buffer, RecordBatch& batch) {
+    return parse_records(buffer, batch, [this](std::string_view data) { return parse(data); });
+}
+
 template <typename FieldType>
 size_t ParserBase<FieldType>::consumed() const noexcept {
     return consumed_;
@@ -62,14 +67,53 @@ bool QuotingParser<FieldType>::is_newline(char c) {
     return this->config_.is_line_ending(c);
 };
 
+// the kernel is resolved once per parser: Config override, then CSVENGINE_KERNEL, then CPU detection
 std::unique_ptr<Parser<std::string>> make_parser(const Config& config) {
+    const auto kernel = simd::resolve_kernel(config.kernel);
+
     if (config.has_quoting) {
         if (config.parse_mode == Config::ParseMode::strict) {
-            return std::make_unique<StrictQuotingParser>(config);
+            switch (kernel) {
+                case Config::Kernel::scalar:
+                    return std::make_unique<StrictQuotingParser>(config);
+                case Config::Kernel::swar:
+                    return std::make_unique<SwarStrictQuotingParser>(config);
+                default:
+                    return std::make_unique<SimdStrictQuotingParser>(config, kernel);
+            }
+        }
+        // the default lenient dialect gets the compile-time specialized loop
+        if (LenientDialect::matches(config)) {
+            return std::make_unique<DialectParser<LenientDialect>>(config);
         }
         return std::make_unique<LenientQuotingParser>(config);
     }
-    return std::make_unique<SimpleParser>(config);
+
+    switch (kernel) {
+        case Config::Kernel::scalar:
+            return std::make_unique<SimpleParser>(config);
+        case Config::Kernel::swar:
+            return std::make_unique<SwarParser>(config);
+        default:
+            return std::make_unique<SimdParser>(config, kernel);
+    }
+}
+
+std::unique_ptr<Parser<std::string_view>> make_view_parser(const Config& config) {
+    const auto kernel = simd::resolve_kernel(config.kernel);
+
+    if (config.has_quoting) {
+        return std::make_unique<ViewQuotingParser>(config, kernel);
+    }
+
+    switch (kernel) {
+        case Config::Kernel::scalar:
+            return std::make_unique<ViewSimpleParser>(config);
+        case Config::Kernel::swar:
+            return std::make_unique<ViewSwarParser>(config);
+        default:
+            return std::make_unique<ViewSimdParser>(config, kernel);
+    }
 }
 
 template class ParserBase<std::string>;
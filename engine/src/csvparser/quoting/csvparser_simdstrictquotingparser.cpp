@@ -0,0 +1,9 @@
+#include <csvparser/csvparser.hpp>
+
+namespace csv {
+
+SimdStrictQuotingParser::SimdStrictQuotingParser(const Config& config, Config::Kernel kernel): StrictQuotingParser(config) {
+    use_kernel(simd::kernel_ops(simd::resolve_kernel(kernel)));
+}
+
+}
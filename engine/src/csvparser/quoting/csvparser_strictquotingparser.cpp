@@ -1,206 +1,53 @@
 #include <iostream>
 #include <cstring>
+#include <algorithm>
 #include <csvparser/csvparser.hpp>
 
 namespace csv {
 
 StrictQuotingParser::StrictQuotingParser(const Config& config): QuotingParser<std::string>(config) {}
 
-ParseStatus StrictQuotingParser::parse(std::string_view buffer) {
-    consumed_ = 0;
-
-    if (buffer.empty()) return ParseStatus::need_more_data;
-
-    const char* buff_it = buffer.data();
-    const char* buff_end = buff_it + buffer.size();
-
-    auto field_start = buff_it;
-    size_t current_field_quote_literals = 0;    
-
-    const auto is_begin   = [&](auto it) { return it == buffer.data(); };
-    const auto is_end     = [&](auto it) { return it == buff_end; };
-    const auto consume    = [&](size_t consume_size = 1) {
-        buff_it += consume_size;
-        consumed_ += consume_size;
-    };
-    const auto add_field =  [&](auto end_it) {
-        if (!incomplete_last_read_) {
-            fields_.emplace_back();
-        }
-
-        std::string& field_ref = fields_.back();
-        size_t write_start = field_ref.size();
-
-        size_t curr_field_size = std::distance(field_start, end_it) - current_field_quote_literals;
-        field_ref.resize(field_ref.size() + curr_field_size);
-
-        if (current_field_quote_literals == 0) {
-            // explicit char* converion by &*
-            std::memcpy(field_ref.data() + write_start, &*field_start, curr_field_size);
-        }
-        else {
-            auto it = field_start;
-            while (it != end_it) {
-                field_ref[write_start++] = *it++;
-                // for double quotes just skip the next one
-                if (it != end_it && is_quote(*it) && is_quote(*(it-1))) it++;
-            }
-        }
-
-        current_field_quote_literals = 0;
-        incomplete_last_read_ = false;
-    };
-
-    if (config_.line_ending == Config::LineEnding::crlf && pending_cr_) {
-        pending_cr_ = false;
-        if (!is_newline(*buff_it)) {
-            return ParseStatus::fail;
-        }
-        else {
-            consume();
-            remove_last_char_from_fields();
-            return ParseStatus::complete;
-        }
+void StrictQuotingParser::use_kernel(const simd::KernelOps& ops) noexcept {
+    find_structural_ = ops.find;
+    if (ops.kernel != Config::Kernel::scalar) {
+        index_ = std::make_unique<StructuralIndex>(config_, ops, true);
     }
+}
 
-    if (pending_quote_) {
-        pending_quote_ = false;
+ParseStatus StrictQuotingParser::parse_batch(std::string_view buffer, RecordBatch& batch) {
+    return parse_records(buffer, batch, [this](std::string_view data) { return StrictQuotingParser::parse(data); });
+}
 
-        if (is_quote(*buff_it)) {
-            in_quotes_ = true;
-            consume();
+ParseStatus StrictQuotingParser::parse(std::string_view buffer) {
+    return parse_as(buffer, RuntimeDialect(config_));
+}
 
-            if (is_end(buff_it)) {
-                incomplete_last_read_ = true;
-                return ParseStatus::need_more_data;
-            }
-        }
-        else if (!is_delim(*buff_it) && !is_newline(*buff_it)) {
-            consume();
-            return ParseStatus::fail;
-        }
-        else if (is_newline(*buff_it)) {
-            consume();
-            return ParseStatus::complete;
-        }
-        else if (is_delim(*buff_it)) {
-            consume(); // we already have the field so we can just skip delim to avoid adding new field
-            field_start = buff_it;
-            incomplete_last_read_ = false;
-        }
+// raw field must be "..." with every inner quote doubled
+bool StrictQuotingParser::add_quoted_field(const char* begin, const char* end, char quote) {
+    if (end - begin < 2 || *begin != quote || *(end - 1) != quote) {
+        return false;
     }
 
-    while (!is_end(buff_it)) {
-        if (is_newline(*buff_it) && !in_quotes_) {
-            auto field_end = buff_it;
-            if (config_.line_ending == Config::LineEnding::crlf) {
-                if (!is_begin(field_end) && *(field_end-1) == '\r') {
-                    field_end--;
-                }
-                else {
-                    return ParseStatus::fail;
-                }
-            }
-            add_field(field_end);
-            consume();
-            return ParseStatus::complete;
-        }
-        
-        if (is_delim(*buff_it) && !in_quotes_) {
-            add_field(buff_it);
-            consume();
-            field_start = buff_it;
-            continue;
-        }
-        
-        if (is_quote(*buff_it)) {
-            auto next_buff_it = buff_it + 1;
-
-            // double quote => literal
-            if (in_quotes_ && !is_end(next_buff_it) && is_quote(*next_buff_it)) {
-                consume(2); // skip one char to make literal
-                current_field_quote_literals++;
-                continue;
-            }
-            // one quote => quoting
-            else if (in_quotes_) {
-                in_quotes_ = false;
-
-                if (!is_end(next_buff_it)) {
-                    bool is_next_delim = is_delim(*next_buff_it);
-                    bool is_next_newline = is_newline(*next_buff_it);
-
-                    if (config_.line_ending == Config::LineEnding::crlf && *next_buff_it == '\r') {
-                        if (!is_end((buff_it+2))) {
-                            // if we have \r\n after quoting then just add field and complete
-                            if (is_newline(*(buff_it+2))) {
-                                add_field(buff_it);
-                                consume(3);
-                                return ParseStatus::complete;
-                            }
-                            return ParseStatus::fail;
-                        }
-                        else {
-                            add_field(buff_it);
-                            consume(2);
-                            fields_.back().push_back('\r');
-                            pending_cr_ = true;
-                            pending_quote_ = true;
-                            return ParseStatus::need_more_data;
-                        }
-                    }
-
-                    // wrong quoting => data after quotes
-                    if (!is_next_delim && !is_next_newline) {
-                        return ParseStatus::fail;
-                    }
-                    
-                    // for delim or newline as next char
-                    add_field(buff_it);
-                    consume(2);
-                    field_start = buff_it;
+    std::string& field = fields_.emplace_back();
+    field.reserve(static_cast<size_t>(end - begin) - 2);
 
-                    if (is_next_delim) {
-                        continue;
-                    }
+    const char* it = begin + 1;
+    const char* content_end = end - 1;
 
-                    if (is_next_newline) {
-                        return ParseStatus::complete;
-                    }
-                }
-                // end, so we need to mark field as incomplete and show that the last char was quote
-                // if the first character of the next buffer will be also quote then we will have just literal
-                else {
-                    // Quote at buffer end
-                    add_field(buff_it);  // Add field without closing quote
-                    pending_quote_ = true;
-                    incomplete_last_read_ = true;
-                    consume();
-                    return ParseStatus::need_more_data;
-                }
-            }
-            else if (buff_it == field_start) {
-                in_quotes_ = true;
-                field_start = buff_it + 1; // skip open quote in field
-            }
-            else {
-                return ParseStatus::fail;
-            }
+    while (it != content_end) {
+        const char* next_quote = static_cast<const char*>(std::memchr(it, quote, static_cast<size_t>(content_end - it)));
+        if (!next_quote) {
+            field.append(it, content_end);
+            break;
         }
-        // skip every other character 
-        consume();
-    }
-
-    if (config_.line_ending == Config::LineEnding::crlf && !in_quotes_ &&
-        !buffer.empty() && buffer.back() == '\r')
-    {
-        pending_cr_ = true;
+        if (next_quote + 1 == content_end || *(next_quote + 1) != quote) {
+            return false;
+        }
+        field.append(it, next_quote + 1); // keep one quote of the "" pair
+        it = next_quote + 2;
     }
 
-    add_field(buff_it);
-    incomplete_last_read_ = true;
-
-    return ParseStatus::need_more_data;
+    return true;
 }
 
 void StrictQuotingParser::remove_last_char_from_fields() {
@@ -0,0 +1,9 @@
+#include <csvparser/csvparser.hpp>
+
+namespace csv {
+
+SwarStrictQuotingParser::SwarStrictQuotingParser(const Config& config): StrictQuotingParser(config) {
+    use_kernel(simd::kernel_ops(Config::Kernel::swar));
+}
+
+}
@@ -0,0 +1,194 @@
+#include <csvparser/csvparser.hpp>
+#include <algorithm>
+#include <cstring>
+
+namespace csv {
+
+// records are split by a quote-aware index in both modes: where every quoted field is a well-formed
+// "..." the lenient and strict readings of a record are the same, other records go to fallback_
+ViewQuotingParser::ViewQuotingParser(const Config& config, Config::Kernel kernel)
+    : QuotingParser<std::string_view>(config)
+    , index_(config, simd::kernel_ops(simd::resolve_kernel(kernel)), true)
+    , fallback_(make_parser(config))
+{}
+
+ParseStatus ViewQuotingParser::parse_batch(std::string_view buffer, RecordBatch& batch) {
+    return parse_records(buffer, batch, [this](std::string_view data) { return ViewQuotingParser::parse(data); });
+}
+
+ParseStatus ViewQuotingParser::parse(std::string_view buffer) {
+    consumed_ = 0;
+    fields_.clear();
+    arena_.clear();
+    record_start_ = buffer.data();
+
+    if (buffer.empty()) return ParseStatus::need_more_data;
+
+    if (parse_indexed(buffer)) {
+        return ParseStatus::complete;
+    }
+
+    fields_.clear();
+    arena_.clear();
+    return parse_copied(buffer);
+}
+
+// A record the index splits differently than the parser (a stray quote in lenient mode flips the
+// quote regions up to the next quote) makes the index rebuild at the next record, so index_window_
+// shrinks after each of them and grows back once a whole window was read from the index.
+bool ViewQuotingParser::parse_indexed(std::string_view buffer) {
+    const size_t record = index_.find_record(buffer.substr(0, index_window_));
+    if (record == std::string_view::npos) {
+        // the record may be longer than the window
+        if (buffer.size() > index_window_) {
+            index_window_ = std::min(2 * index_window_, StructuralIndex::MAX_WINDOW);
+        }
+        return false;
+    }
+
+    // unescaped fields are never longer than the raw record, so views into the arena stay valid
+    const size_t record_size = index_.record_end(record) - index_.record_begin(record);
+    if (arena_.capacity() < record_size) {
+        arena_.reserve(record_size);
+    }
+
+    const bool strict = config_.parse_mode == Config::ParseMode::strict;
+    const size_t field_count = index_.field_count(record);
+    size_t cr_stripped = 0;
+
+    for (size_t column = 0; column < field_count; column++) {
+        std::string_view raw = index_.raw_field(record, column);
+
+        if (column + 1 == field_count && config_.line_ending == Config::LineEnding::crlf) {
+            if (!raw.empty() && raw.back() == '\r') {
+                raw.remove_suffix(1);
+                cr_stripped = 1;
+            }
+            else if (strict) {
+                return false;
+            }
+        }
+
+        if (!index_.field_has_quotes(record, column)) {
+            fields_.push_back(raw);
+        }
+        else if (!add_quoted_field(raw)) {
+            index_window_ = std::max(index_window_ / 2, MIN_INDEX_WINDOW);
+            return false;
+        }
+    }
+
+    if (index_.record_end(record) == index_.indexed_bytes()) {
+        index_window_ = std::min(2 * index_window_, StructuralIndex::MAX_WINDOW);
+    }
+    consumed_ = record_size;
+
+    // an empty line is a record without fields, as in ViewSimpleParser
+    if (consumed_ == 1 + cr_stripped) {
+        fields_.clear();
+    }
+    return true;
+}
+
+// raw field must be "..." with every inner quote doubled
+bool ViewQuotingParser::add_quoted_field(std::string_view raw) {
+    const char quote = config_.quote_char;
+
+    if (raw.size() < 2 || raw.front() != quote || raw.back() != quote) {
+        return false;
+    }
+
+    std::string_view content = raw.substr(1, raw.size() - 2);
+    const char* next_quote = static_cast<const char*>(std::memchr(content.data(), quote, content.size()));
+    if (!next_quote) {
+        fields_.push_back(content);
+        return true;
+    }
+
+    const size_t arena_start = arena_.size();
+    const char* it = content.data();
+    const char* content_end = content.data() + content.size();
+
+    while (next_quote) {
+        if (next_quote + 1 == content_end || *(next_quote + 1) != quote) {
+            return false;
+        }
+        arena_.append(it, next_quote + 1); // keep one quote of the "" pair
+        it = next_quote + 2;
+        next_quote = static_cast<const char*>(std::memchr(it, quote, static_cast<size_t>(content_end - it)));
+    }
+    arena_.append(it, content_end);
+
+    fields_.emplace_back(arena_.data() + arena_start, arena_.size() - arena_start);
+    return true;
+}
+
+// Records the index cannot decide (not finished in this buffer, malformed quoting)
+// go through the string parser of the same mode, so the semantics match Reader exactly.
+// A partial record without quotes is still split into views: it is what ViewReader returns at EOF.
+ParseStatus ViewQuotingParser::parse_copied(std::string_view buffer) {
+    fallback_->reset();
+    const ParseStatus status = fallback_->parse(buffer);
+
+    if (status == ParseStatus::need_more_data &&
+        !std::memchr(buffer.data(), config_.quote_char, buffer.size()))
+    {
+        size_t field_start = 0;
+        for (size_t pos = 0; pos < buffer.size(); pos++) {
+            if (buffer[pos] == config_.delimiter) {
+                fields_.push_back(buffer.substr(field_start, pos - field_start));
+                field_start = pos + 1;
+            }
+        }
+        fields_.push_back(buffer.substr(field_start));
+        return status;
+    }
+
+    size_t total_size = 0;
+    for (const auto& field : fallback_->fields()) {
+        total_size += field.size();
+    }
+    if (arena_.capacity() < total_size) {
+        arena_.reserve(total_size);
+    }
+
+    for (const auto& field : fallback_->fields()) {
+        const size_t arena_start = arena_.size();
+        arena_ += field;
+        fields_.emplace_back(arena_.data() + arena_start, field.size());
+    }
+
+    if (status == ParseStatus::complete) {
+        consumed_ = fallback_->consumed();
+    }
+    return status;
+}
+
+bool ViewQuotingParser::in_arena(std::string_view field) const noexcept {
+    return field.data() >= arena_.data() && field.data() <= arena_.data() + arena_.size();
+}
+
+void ViewQuotingParser::shift_views(const char* buffer_start) {
+    if (!record_start_ || record_start_ == buffer_start) return;
+
+    for (auto& field : fields_) {
+        if (!in_arena(field)) {
+            field = std::string_view(buffer_start + (field.data() - record_start_), field.size());
+        }
+    }
+    record_start_ = buffer_start;
+}
+
+void ViewQuotingParser::reset() noexcept {
+    QuotingParser<std::string_view>::reset();
+    arena_.clear();
+    record_start_ = nullptr;
+}
+
+void ViewQuotingParser::remove_last_char_from_fields() {
+    if (!fields_.empty() && !fields_.back().empty()) {
+        fields_.back().remove_suffix(1);
+    }
+}
+
+}
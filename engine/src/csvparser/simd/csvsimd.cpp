@@ -0,0 +1,185 @@
+#include <csvparser/csvsimd.hpp>
+#include <bit>
+#include <cstring>
+#include <cstdlib>
+
+namespace csv::simd {
+
+StructuralMasks scan_scalar(const char* block, char delimiter, char newline, char quote) noexcept {
+    StructuralMasks masks;
+    for (size_t i = 0; i < BLOCK_SIZE; i++) {
+        const uint64_t bit = uint64_t{1} << i;
+        masks.delimiter |= (block[i] == delimiter) ? bit : 0;
+        masks.newline   |= (block[i] == newline)   ? bit : 0;
+        masks.quote     |= (block[i] == quote)     ? bit : 0;
+    }
+    return masks;
+}
+
+uint64_t prefix_xor_shift(uint64_t mask) noexcept {
+    mask ^= mask << 1;
+    mask ^= mask << 2;
+    mask ^= mask << 4;
+    mask ^= mask << 8;
+    mask ^= mask << 16;
+    mask ^= mask << 32;
+    return mask;
+}
+
+size_t tokenize(ScanFn scan, std::string_view buffer, char delimiter, char newline,
+                std::vector<std::string_view>& fields)
+{
+    fields.clear();
+
+    const char* data = buffer.data();
+    const size_t size = buffer.size();
+    size_t field_start = 0;
+
+    for (size_t block_start = 0; block_start < size; block_start += BLOCK_SIZE) {
+        const size_t block_len = std::min(BLOCK_SIZE, size - block_start);
+        StructuralMasks masks;
+
+        if (block_len == BLOCK_SIZE) {
+            masks = scan(data + block_start, delimiter, newline, '\0');
+        }
+        else {
+            // the last partial block is copied so the kernel never reads past the buffer
+            alignas(BLOCK_SIZE) char tail[BLOCK_SIZE] = {};
+            std::memcpy(tail, data + block_start, block_len);
+            masks = scan(tail, delimiter, newline, '\0');
+
+            const uint64_t valid = (uint64_t{1} << block_len) - 1;
+            masks.delimiter &= valid;
+            masks.newline &= valid;
+        }
+
+        uint64_t structural = masks.delimiter | masks.newline;
+        while (structural) {
+            const int bit = std::countr_zero(structural);
+            const size_t pos = block_start + static_cast<size_t>(bit);
+
+            fields.emplace_back(data + field_start, pos - field_start);
+
+            if ((masks.newline >> bit) & 1) {
+                return pos;
+            }
+
+            field_start = pos + 1;
+            structural &= structural - 1;
+        }
+    }
+
+    fields.emplace_back(data + field_start, size - field_start);
+    return std::string_view::npos;
+}
+
+bool supported(Config::Kernel kernel) noexcept {
+#if defined(__x86_64__) || defined(__i386__)
+    static const bool has_sse42 = __builtin_cpu_supports("sse4.2");
+    static const bool has_avx2 = __builtin_cpu_supports("avx2");
+    static const bool has_avx512 = __builtin_cpu_supports("avx512bw");
+#else
+    constexpr bool has_sse42 = false;
+    constexpr bool has_avx2 = false;
+    constexpr bool has_avx512 = false;
+#endif
+
+    switch (kernel) {
+        case Config::Kernel::automatic:
+        case Config::Kernel::scalar:
+        case Config::Kernel::swar:
+            return true;
+        case Config::Kernel::sse42:
+            return has_sse42;
+        case Config::Kernel::avx2:
+            return has_avx2;
+        case Config::Kernel::avx512:
+            return has_avx512;
+        default:
+            return false;
+    }
+}
+
+bool avx2_supported() noexcept {
+    return supported(Config::Kernel::avx2);
+}
+
+Config::Kernel best_kernel() noexcept {
+    static const Config::Kernel best = [] {
+        for (auto kernel : {Config::Kernel::avx512, Config::Kernel::avx2, Config::Kernel::sse42}) {
+            if (supported(kernel)) {
+                return kernel;
+            }
+        }
+        return Config::Kernel::swar;
+    }();
+    return best;
+}
+
+Config::Kernel resolve_kernel(Config::Kernel requested) noexcept {
+    if (requested == Config::Kernel::automatic) {
+        const char* env = std::getenv(KERNEL_ENV_VAR);
+        auto from_env = env ? parse_kernel(env) : std::nullopt;
+        if (!from_env || *from_env == Config::Kernel::automatic) {
+            return best_kernel();
+        }
+        requested = *from_env;
+    }
+
+    // degrade avx512 -> avx2 -> sse42 -> swar
+    while (!supported(requested)) {
+        requested = static_cast<Config::Kernel>(static_cast<int>(requested) - 1);
+    }
+    return requested;
+}
+
+static bool clmul_supported() noexcept {
+#if defined(__x86_64__) || defined(__i386__)
+    static const bool supported = __builtin_cpu_supports("pclmul");
+    return supported;
+#else
+    return false;
+#endif
+}
+
+const KernelOps& kernel_ops(Config::Kernel kernel) noexcept {
+    static const PrefixXorFn vector_prefix_xor = clmul_supported() ? prefix_xor_clmul : prefix_xor_shift;
+    static const KernelOps ops[] = {
+        {Config::Kernel::scalar, scan_scalar, nullptr,                prefix_xor_shift},
+        {Config::Kernel::swar,   scan_swar,   find_structural_swar,   prefix_xor_shift},
+        {Config::Kernel::sse42,  scan_sse42,  find_structural_sse42,  vector_prefix_xor},
+        {Config::Kernel::avx2,   scan_avx2,   find_structural_avx2,   vector_prefix_xor},
+        {Config::Kernel::avx512, scan_avx512, find_structural_avx512, vector_prefix_xor},
+    };
+
+    for (const auto& op : ops) {
+        if (op.kernel == kernel) {
+            return op;
+        }
+    }
+    return ops[0];
+}
+
+std::string_view kernel_name(Config::Kernel kernel) noexcept {
+    switch (kernel) {
+        case Config::Kernel::automatic: return "automatic";
+        case Config::Kernel::scalar:    return "scalar";
+        case Config::Kernel::swar:      return "swar";
+        case Config::Kernel::sse42:     return "sse42";
+        case Config::Kernel::avx2:      return "avx2";
+        case Config::Kernel::avx512:    return "avx512";
+        default:                        return "unknown";
+    }
+}
+
+std::optional<Config::Kernel> parse_kernel(std::string_view name) noexcept {
+    for (auto kernel : {Config::Kernel::automatic, Config::Kernel::scalar, Config::Kernel::swar,
+                        Config::Kernel::sse42, Config::Kernel::avx2, Config::Kernel::avx512}) {
+        if (kernel_name(kernel) == name) {
+            return kernel;
+        }
+    }
+    return std::nullopt;
+}
+
+}
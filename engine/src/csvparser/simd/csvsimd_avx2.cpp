@@ -0,0 +1,67 @@
+#include <csvparser/csvsimd.hpp>
+#include <bit>
+
+#if defined(__x86_64__) || defined(__i386__)
+#include <immintrin.h>
+#endif
+
+namespace csv::simd {
+
+#if defined(__x86_64__) || defined(__i386__)
+
+// compiled for AVX2 regardless of the global flags, callers must check supported() first
+__attribute__((target("avx2")))
+static inline uint64_t match_avx2(__m256i lo, __m256i hi, char c) noexcept {
+    const __m256i needle = _mm256_set1_epi8(c);
+    const uint32_t lo_bits = static_cast<uint32_t>(_mm256_movemask_epi8(_mm256_cmpeq_epi8(lo, needle)));
+    const uint32_t hi_bits = static_cast<uint32_t>(_mm256_movemask_epi8(_mm256_cmpeq_epi8(hi, needle)));
+    return uint64_t{lo_bits} | (uint64_t{hi_bits} << 32);
+}
+
+__attribute__((target("avx2")))
+StructuralMasks scan_avx2(const char* block, char delimiter, char newline, char quote) noexcept {
+    const __m256i lo = _mm256_loadu_si256(reinterpret_cast<const __m256i*>(block));
+    const __m256i hi = _mm256_loadu_si256(reinterpret_cast<const __m256i*>(block + 32));
+
+    return {
+        .delimiter = match_avx2(lo, hi, delimiter),
+        .newline = match_avx2(lo, hi, newline),
+        .quote = match_avx2(lo, hi, quote),
+    };
+}
+
+__attribute__((target("avx2")))
+const char* find_structural_avx2(const char* begin, const char* end, char delimiter, char newline, char quote) noexcept {
+    const __m256i delimiters = _mm256_set1_epi8(delimiter);
+    const __m256i newlines = _mm256_set1_epi8(newline);
+    const __m256i quotes = _mm256_set1_epi8(quote);
+
+    const char* it = begin;
+    while (end - it >= 32) {
+        const __m256i chunk = _mm256_loadu_si256(reinterpret_cast<const __m256i*>(it));
+        const __m256i found = _mm256_or_si256(_mm256_or_si256(
+            _mm256_cmpeq_epi8(chunk, delimiters), _mm256_cmpeq_epi8(chunk, newlines)), _mm256_cmpeq_epi8(chunk, quotes));
+        const uint32_t bits = static_cast<uint32_t>(_mm256_movemask_epi8(found));
+
+        if (bits) {
+            return it + std::countr_zero(bits);
+        }
+        it += 32;
+    }
+
+    return find_structural_swar(it, end, delimiter, newline, quote);
+}
+
+#else
+
+StructuralMasks scan_avx2(const char* block, char delimiter, char newline, char quote) noexcept {
+    return scan_swar(block, delimiter, newline, quote);
+}
+
+const char* find_structural_avx2(const char* begin, const char* end, char delimiter, char newline, char quote) noexcept {
+    return find_structural_swar(begin, end, delimiter, newline, quote);
+}
+
+#endif
+
+}
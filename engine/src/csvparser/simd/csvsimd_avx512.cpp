@@ -0,0 +1,62 @@
+#include <csvparser/csvsimd.hpp>
+#include <bit>
+
+#if defined(__x86_64__)
+#include <immintrin.h>
+#endif
+
+namespace csv::simd {
+
+#if defined(__x86_64__)
+
+// compiled for AVX-512BW regardless of the global flags, callers must check supported() first
+__attribute__((target("avx512f,avx512bw")))
+StructuralMasks scan_avx512(const char* block, char delimiter, char newline, char quote) noexcept {
+    const __m512i chunk = _mm512_loadu_si512(block);
+
+    return {
+        .delimiter = _mm512_cmpeq_epi8_mask(chunk, _mm512_set1_epi8(delimiter)),
+        .newline = _mm512_cmpeq_epi8_mask(chunk, _mm512_set1_epi8(newline)),
+        .quote = _mm512_cmpeq_epi8_mask(chunk, _mm512_set1_epi8(quote)),
+    };
+}
+
+__attribute__((target("avx512f,avx512bw")))
+const char* find_structural_avx512(const char* begin, const char* end, char delimiter, char newline, char quote) noexcept {
+    const __m512i delimiters = _mm512_set1_epi8(delimiter);
+    const __m512i newlines = _mm512_set1_epi8(newline);
+    const __m512i quotes = _mm512_set1_epi8(quote);
+
+    const char* it = begin;
+    while (it < end) {
+        const size_t remaining = static_cast<size_t>(end - it);
+
+        // masked load for the tail, so no byte past end is touched
+        const __mmask64 valid = remaining >= BLOCK_SIZE ? ~__mmask64{0} : (__mmask64{1} << remaining) - 1;
+        const __m512i chunk = _mm512_maskz_loadu_epi8(valid, it);
+
+        const uint64_t bits = (_mm512_cmpeq_epi8_mask(chunk, delimiters) |
+                               _mm512_cmpeq_epi8_mask(chunk, newlines) |
+                               _mm512_cmpeq_epi8_mask(chunk, quotes)) & valid;
+        if (bits) {
+            return it + std::countr_zero(bits);
+        }
+        it += std::min(remaining, BLOCK_SIZE);
+    }
+
+    return end;
+}
+
+#else
+
+StructuralMasks scan_avx512(const char* block, char delimiter, char newline, char quote) noexcept {
+    return scan_swar(block, delimiter, newline, quote);
+}
+
+const char* find_structural_avx512(const char* begin, const char* end, char delimiter, char newline, char quote) noexcept {
+    return find_structural_swar(begin, end, delimiter, newline, quote);
+}
+
+#endif
+
+}
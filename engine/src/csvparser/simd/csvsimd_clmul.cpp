@@ -0,0 +1,28 @@
+#include <csvparser/csvsimd.hpp>
+
+#if defined(__x86_64__)
+#include <immintrin.h>
+#endif
+
+namespace csv::simd {
+
+#if defined(__x86_64__)
+
+// carry-less multiplication by all ones XORs every lower bit into each position in one instruction,
+// callers must check for PCLMULQDQ first (kernel_ops does)
+__attribute__((target("pclmul,sse2")))
+uint64_t prefix_xor_clmul(uint64_t mask) noexcept {
+    const __m128i value = _mm_set_epi64x(0, static_cast<long long>(mask));
+    const __m128i ones = _mm_set1_epi8(static_cast<char>(0xFF));
+    return static_cast<uint64_t>(_mm_cvtsi128_si64(_mm_clmulepi64_si128(value, ones, 0)));
+}
+
+#else
+
+uint64_t prefix_xor_clmul(uint64_t mask) noexcept {
+    return prefix_xor_shift(mask);
+}
+
+#endif
+
+}
@@ -0,0 +1,64 @@
+#include <csvparser/csvsimd.hpp>
+#include <bit>
+
+#if defined(__x86_64__) || defined(__i386__)
+#include <immintrin.h>
+#endif
+
+namespace csv::simd {
+
+#if defined(__x86_64__) || defined(__i386__)
+
+// compiled for SSE4.2 regardless of the global flags, callers must check supported() first
+__attribute__((target("sse4.2")))
+static inline uint32_t match_sse42(__m128i chunk, char c) noexcept {
+    return static_cast<uint32_t>(_mm_movemask_epi8(_mm_cmpeq_epi8(chunk, _mm_set1_epi8(c))));
+}
+
+__attribute__((target("sse4.2")))
+StructuralMasks scan_sse42(const char* block, char delimiter, char newline, char quote) noexcept {
+    StructuralMasks masks;
+    for (unsigned i = 0; i < BLOCK_SIZE / 16; i++) {
+        const __m128i chunk = _mm_loadu_si128(reinterpret_cast<const __m128i*>(block + i * 16));
+        masks.delimiter |= uint64_t{match_sse42(chunk, delimiter)} << (i * 16);
+        masks.newline   |= uint64_t{match_sse42(chunk, newline)} << (i * 16);
+        masks.quote     |= uint64_t{match_sse42(chunk, quote)} << (i * 16);
+    }
+    return masks;
+}
+
+__attribute__((target("sse4.2")))
+const char* find_structural_sse42(const char* begin, const char* end, char delimiter, char newline, char quote) noexcept {
+    const __m128i delimiters = _mm_set1_epi8(delimiter);
+    const __m128i newlines = _mm_set1_epi8(newline);
+    const __m128i quotes = _mm_set1_epi8(quote);
+
+    const char* it = begin;
+    while (end - it >= 16) {
+        const __m128i chunk = _mm_loadu_si128(reinterpret_cast<const __m128i*>(it));
+        const __m128i found = _mm_or_si128(_mm_or_si128(
+            _mm_cmpeq_epi8(chunk, delimiters), _mm_cmpeq_epi8(chunk, newlines)), _mm_cmpeq_epi8(chunk, quotes));
+        const uint32_t bits = static_cast<uint32_t>(_mm_movemask_epi8(found));
+
+        if (bits) {
+            return it + std::countr_zero(bits);
+        }
+        it += 16;
+    }
+
+    return find_structural_swar(it, end, delimiter, newline, quote);
+}
+
+#else
+
+StructuralMasks scan_sse42(const char* block, char delimiter, char newline, char quote) noexcept {
+    return scan_swar(block, delimiter, newline, quote);
+}
+
+const char* find_structural_sse42(const char* begin, const char* end, char delimiter, char newline, char quote) noexcept {
+    return find_structural_swar(begin, end, delimiter, newline, quote);
+}
+
+#endif
+
+}
@@ -0,0 +1,80 @@
+#include <csvparser/csvsimd.hpp>
+#include <bit>
+#include <cstring>
+
+namespace csv::simd {
+
+// SIMD within a register: 8 bytes are compared at once in a plain uint64_t,
+// so this kernel runs on any 64-bit host, including ones with AVX masked off
+
+namespace {
+
+constexpr uint64_t ONES  = 0x0101010101010101ULL;
+constexpr uint64_t LOW7  = 0x7F7F7F7F7F7F7F7FULL;
+
+inline uint64_t load_word(const char* ptr) noexcept {
+    uint64_t word;
+    std::memcpy(&word, ptr, sizeof(word));
+    if constexpr (std::endian::native == std::endian::big) {
+        word = __builtin_bswap64(word);
+    }
+    return word;
+}
+
+inline uint64_t broadcast(char c) noexcept {
+    return ONES * static_cast<unsigned char>(c);
+}
+
+// 0x80 in every byte equal to the pattern byte, exact (no borrow false positives)
+inline uint64_t equal_bytes(uint64_t word, uint64_t pattern) noexcept {
+    const uint64_t x = word ^ pattern;
+    return ~(((x & LOW7) + LOW7) | x | LOW7);
+}
+
+// gathers the 0x80 flags of the 8 bytes into the low 8 bits
+inline uint64_t byte_mask(uint64_t flags) noexcept {
+    return ((flags >> 7) * 0x0102040810204080ULL) >> 56;
+}
+
+}
+
+StructuralMasks scan_swar(const char* block, char delimiter, char newline, char quote) noexcept {
+    const uint64_t delimiters = broadcast(delimiter);
+    const uint64_t newlines = broadcast(newline);
+    const uint64_t quotes = broadcast(quote);
+
+    StructuralMasks masks;
+    for (size_t i = 0; i < BLOCK_SIZE / sizeof(uint64_t); i++) {
+        const uint64_t word = load_word(block + i * sizeof(uint64_t));
+        const unsigned shift = static_cast<unsigned>(i * sizeof(uint64_t));
+
+        masks.delimiter |= byte_mask(equal_bytes(word, delimiters)) << shift;
+        masks.newline   |= byte_mask(equal_bytes(word, newlines)) << shift;
+        masks.quote     |= byte_mask(equal_bytes(word, quotes)) << shift;
+    }
+    return masks;
+}
+
+const char* find_structural_swar(const char* begin, const char* end, char delimiter, char newline, char quote) noexcept {
+    const uint64_t delimiters = broadcast(delimiter);
+    const uint64_t newlines = broadcast(newline);
+    const uint64_t quotes = broadcast(quote);
+
+    const char* it = begin;
+    while (end - it >= static_cast<std::ptrdiff_t>(sizeof(uint64_t))) {
+        const uint64_t word = load_word(it);
+        const uint64_t found = equal_bytes(word, delimiters) | equal_bytes(word, newlines) | equal_bytes(word, quotes);
+
+        if (found) {
+            return it + std::countr_zero(found) / 8;
+        }
+        it += sizeof(uint64_t);
+    }
+
+    while (it != end && *it != delimiter && *it != newline && *it != quote) {
+        it++;
+    }
+    return it;
+}
+
+}
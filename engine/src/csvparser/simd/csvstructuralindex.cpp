@@ -0,0 +1,163 @@
+#include <csvparser/csvstructuralindex.hpp>
+#include <algorithm>
+#include <bit>
+#include <cstring>
+
+namespace csv {
+
+StructuralIndex::StructuralIndex(const Config& config, const simd::KernelOps& ops, bool quote_aware)
+    : scan_(ops.scan)
+    , prefix_xor_(ops.prefix_xor)
+    , delimiter_(config.delimiter)
+    , newline_(config.line_ending == Config::LineEnding::cr ? '\r' : '\n')
+    , quote_(config.quote_char)
+    , quote_aware_(quote_aware)
+{}
+
+void StructuralIndex::build(std::string_view window) {
+    clear();
+    window_ = window.substr(0, std::min(window.size(), MAX_WINDOW));
+
+    const char* data = window_.data();
+    const size_t size = window_.size();
+
+    uint64_t quote_carry = 0;
+    size_t quotes_before_block = 0;
+    size_t field_start_quotes = 0;
+
+    for (size_t block_start = 0; block_start < size; block_start += simd::BLOCK_SIZE) {
+        const size_t block_len = std::min(simd::BLOCK_SIZE, size - block_start);
+        simd::StructuralMasks masks;
+
+        if (block_len == simd::BLOCK_SIZE) {
+            masks = scan_(data + block_start, delimiter_, newline_, quote_);
+        }
+        else {
+            alignas(simd::BLOCK_SIZE) char tail[simd::BLOCK_SIZE] = {};
+            std::memcpy(tail, data + block_start, block_len);
+            masks = scan_(tail, delimiter_, newline_, quote_);
+
+            const uint64_t valid = (uint64_t{1} << block_len) - 1;
+            masks.delimiter &= valid;
+            masks.newline &= valid;
+            masks.quote &= valid;
+        }
+
+        uint64_t structural = masks.delimiter | masks.newline;
+        if (quote_aware_) {
+            const uint64_t quote_regions = prefix_xor_(masks.quote) ^ quote_carry;
+            quote_carry = static_cast<uint64_t>(static_cast<int64_t>(quote_regions) >> 63);
+            structural &= ~quote_regions;
+        }
+
+        // reserve the worst case once per block so the bit loop only writes
+        size_t count = offsets_.size();
+        offsets_.resize(count + static_cast<size_t>(std::popcount(structural)));
+        uint32_t* out = offsets_.data();
+
+        while (structural) {
+            const int bit = std::countr_zero(structural);
+            uint32_t offset = static_cast<uint32_t>(block_start + static_cast<size_t>(bit));
+
+            const size_t quotes_at = quotes_before_block +
+                static_cast<size_t>(std::popcount(masks.quote & ((uint64_t{1} << bit) - 1)));
+            if (quotes_at != field_start_quotes) {
+                offset |= QUOTED_FLAG;
+            }
+            field_start_quotes = quotes_at;
+
+            if ((masks.newline >> bit) & 1) {
+                records_.push_back(static_cast<uint32_t>(count));
+            }
+            out[count++] = offset;
+            structural &= structural - 1;
+        }
+
+        quotes_before_block += static_cast<size_t>(std::popcount(masks.quote));
+    }
+
+    // fields after the last newline belong to a record that is not complete in this window
+    offsets_.resize(records_.empty() ? 0 : records_.back() + 1);
+}
+
+void StructuralIndex::clear() noexcept {
+    window_ = {};
+    offsets_.clear();
+    records_.clear();
+    next_record_ = 0;
+}
+
+size_t StructuralIndex::find_record(std::string_view buffer) {
+    const bool continues_window =
+        next_record_ < records_.size() &&
+        buffer.data() == window_.data() + record_begin(next_record_) &&
+        buffer.data() + buffer.size() >= window_.data() + indexed_bytes();
+
+    if (!continues_window) {
+        build(buffer);
+    }
+
+    if (next_record_ >= records_.size()) {
+        return std::string_view::npos;
+    }
+    return next_record_++;
+}
+
+std::string_view StructuralIndex::window() const noexcept {
+    return window_;
+}
+
+size_t StructuralIndex::record_count() const noexcept {
+    return records_.size();
+}
+
+size_t StructuralIndex::first_offset(size_t record) const noexcept {
+    return record == 0 ? 0 : records_[record - 1] + 1;
+}
+
+size_t StructuralIndex::field_count(size_t record) const noexcept {
+    return records_[record] - first_offset(record) + 1;
+}
+
+size_t StructuralIndex::record_begin(size_t record) const noexcept {
+    return record == 0 ? 0 : (offsets_[records_[record - 1]] & ~QUOTED_FLAG) + 1;
+}
+
+size_t StructuralIndex::record_end(size_t record) const noexcept {
+    return (offsets_[records_[record]] & ~QUOTED_FLAG) + 1;
+}
+
+size_t StructuralIndex::indexed_bytes() const noexcept {
+    return records_.empty() ? 0 : record_end(records_.size() - 1);
+}
+
+std::string_view StructuralIndex::raw_field(size_t record, size_t column) const noexcept {
+    const size_t index = first_offset(record) + column;
+    const size_t begin = column == 0 ? record_begin(record) : (offsets_[index - 1] & ~QUOTED_FLAG) + 1;
+    const size_t end = offsets_[index] & ~QUOTED_FLAG;
+    return window_.substr(begin, end - begin);
+}
+
+bool StructuralIndex::field_has_quotes(size_t record, size_t column) const noexcept {
+    return offsets_[first_offset(record) + column] & QUOTED_FLAG;
+}
+
+void StructuralIndex::record_fields(size_t record, std::vector<std::string_view>& fields) const {
+    fields.clear();
+
+    const size_t first = first_offset(record);
+    const size_t last = records_[record];
+    size_t begin = record_begin(record);
+
+    for (size_t index = first; index <= last; index++) {
+        const size_t end = offsets_[index] & ~QUOTED_FLAG;
+        fields.emplace_back(window_.data() + begin, end - begin);
+        begin = end + 1;
+    }
+}
+
+const std::vector<uint32_t>& StructuralIndex::offsets() const noexcept {
+    return offsets_;
+}
+
+}
@@ -1,20 +1,12 @@
-#include <iostream>
 #include <csvparser/csvparser.hpp>
-#include <cstring>
 
 namespace csv {
 
-SimdParser::SimdParser(const Config& config): Parser<std::string>(config) {}
-
-ParseStatus SimdParser::parse(std::string_view buffer) {
-    consumed_ = 0;
-
-    const char newline = config_.line_ending == Config::LineEnding::cr ? '\r' : '\n';
-    const char *newline_ptr = static_cast<const char*>(memchr(buffer.data(), newline, buffer.size()));
-
-
-    incomplete_last_read_ = false;
-    return ParseStatus::complete;
+// the kernel is resolved against the running CPU, so constructing it directly is always safe
+SimdParser::SimdParser(const Config& config, Config::Kernel kernel)
+    : SimpleParser(config)
+{
+    use_kernel(simd::kernel_ops(simd::resolve_kernel(kernel)));
 }
 
-}
\ No newline at end of file
+}
@@ -7,21 +7,49 @@ template <typename FieldType>
 SimpleParserBase<FieldType>::SimpleParserBase(const Config& config): Parser<FieldType>(config) {}
 
 template <typename FieldType>
-std::vector<std::string_view> SimpleParserBase<FieldType>::split(std::string_view str, const char delim) const {
-    std::vector<std::string_view> result;
+void SimpleParserBase<FieldType>::split(std::string_view str, const char delim, std::vector<std::string_view>& fields) const {
     const char* str_end = str.data() + str.size();
     const char* start = str.data();
     const char* end = static_cast<const char*>(memchr(str.data(), delim, str.size()));
 
     while(end) {
-        result.emplace_back(start, static_cast<size_t>(end - start));
+        fields.emplace_back(start, static_cast<size_t>(end - start));
         start = end + 1;
         end = static_cast<const char*>(memchr(start, delim, str_end - start));
     }
 
-    result.emplace_back(start, static_cast<size_t>(str_end - start));
+    fields.emplace_back(start, static_cast<size_t>(str_end - start));
+}
 
-    return result;
+template <typename FieldType>
+void SimpleParserBase<FieldType>::use_kernel(const simd::KernelOps& ops) {
+    // quotes are ordinary data for simple parsers
+    index_ = std::make_unique<StructuralIndex>(this->config_, ops, false);
+    scan_ = ops.scan;
+}
+
+template <typename FieldType>
+size_t SimpleParserBase<FieldType>::tokenize(std::string_view buffer, const char newline, std::vector<std::string_view>& fields) {
+    if (index_) {
+        const size_t record = index_->find_record(buffer);
+        if (record == std::string_view::npos) {
+            return simd::tokenize(scan_, buffer, this->config_.delimiter, newline, fields);
+        }
+        index_->record_fields(record, fields);
+        return index_->record_end(record) - index_->record_begin(record) - 1;
+    }
+
+    fields.clear();
+
+    const char *newline_ptr = static_cast<const char*>(memchr(buffer.data(), newline, buffer.size()));
+    if (!newline_ptr) {
+        split(buffer, this->config_.delimiter, fields);
+        return std::string_view::npos;
+    }
+
+    const size_t newline_pos = static_cast<size_t>(newline_ptr - buffer.data());
+    split(buffer.substr(0, newline_pos), this->config_.delimiter, fields);
+    return newline_pos;
 }
 
 template <typename FieldType>
@@ -35,17 +63,21 @@ void SimpleParserBase<FieldType>::insert_fields(const std::vector<std::string_vi
     }
 }
 
+template <typename FieldType>
+ParseStatus SimpleParserBase<FieldType>::parse_batch(std::string_view buffer, RecordBatch& batch) {
+    return this->parse_records(buffer, batch, [this](std::string_view data) { return SimpleParserBase::parse(data); });
+}
+
 template <typename FieldType>
 ParseStatus SimpleParserBase<FieldType>::parse(std::string_view buffer) {
     this->consumed_ = 0;
 
     const char newline = this->config_.line_ending == Config::LineEnding::cr ? '\r' : '\n';
-    const char *newline_ptr = static_cast<const char*>(memchr(buffer.data(), newline, buffer.size()));
-    
-    if (!newline_ptr) {
+    const size_t newline_pos = tokenize(buffer, newline, tokens_);
+
+    if (newline_pos == std::string_view::npos) {
         if (!buffer.empty()) {
-            auto fields = split(buffer, this->config_.delimiter);
-            insert_fields(fields);
+            insert_fields(tokens_);
             this->consumed_ = buffer.size();
             this->incomplete_last_read_ = true;
             if (buffer.back() == '\r') {
@@ -55,18 +87,18 @@ ParseStatus SimpleParserBase<FieldType>::parse(std::string_view buffer) {
         return ParseStatus::need_more_data;
     }
 
-    const size_t newline_pos = static_cast<size_t>(newline_ptr - buffer.data());
-    auto line = buffer.substr(0, newline_pos);
+    size_t line_size = newline_pos;
 
     if (this->config_.line_ending == Config::LineEnding::crlf) {
-        if (!line.empty() && line.back() == '\r') {
-            line.remove_suffix(1);
+        if (line_size > 0 && buffer[line_size - 1] == '\r') {
+            line_size--;
+            tokens_.back().remove_suffix(1);
         }
     }
 
     this->consumed_ = newline_pos + 1;
 
-    if (line.empty()) {
+    if (line_size == 0) {
         if (this->config_.line_ending == Config::LineEnding::crlf && this->pending_cr_) {
             this->remove_last_char_from_fields();
             this->pending_cr_ = false;
@@ -75,8 +107,7 @@ ParseStatus SimpleParserBase<FieldType>::parse(std::string_view buffer) {
         return ParseStatus::complete;
     }
 
-    auto fields = split(line, this->config_.delimiter);
-    insert_fields(fields);
+    insert_fields(tokens_);
 
     this->incomplete_last_read_ = false;
     return ParseStatus::complete;
@@ -0,0 +1,9 @@
+#include <csvparser/csvparser.hpp>
+
+namespace csv {
+
+SwarParser::SwarParser(const Config& config): SimpleParser(config) {
+    use_kernel(simd::kernel_ops(Config::Kernel::swar));
+}
+
+}
@@ -0,0 +1,11 @@
+#include <csvparser/csvparser.hpp>
+
+namespace csv {
+
+ViewSimdParser::ViewSimdParser(const Config& config, Config::Kernel kernel)
+    : ViewSimpleParser(config)
+{
+    use_kernel(simd::kernel_ops(simd::resolve_kernel(kernel)));
+}
+
+}
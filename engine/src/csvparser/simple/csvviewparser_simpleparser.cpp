@@ -21,7 +21,8 @@ void ViewSimpleParser::add_field(const std::string_view& field) {
 }
 
 void ViewSimpleParser::shift_views(const char* new_buffer_start) {
-    if (fields_.empty()) return;
+    // buffers that refill behind the leftover (RingBuffer) do not move it
+    if (fields_.empty() || fields_[0].data() == new_buffer_start) return;
 
     auto old_fields_data_start = fields_[0].data();
 
@@ -0,0 +1,9 @@
+#include <csvparser/csvparser.hpp>
+
+namespace csv {
+
+ViewSwarParser::ViewSwarParser(const Config& config): ViewSimpleParser(config) {
+    use_kernel(simd::kernel_ops(Config::Kernel::swar));
+}
+
+}
@@ -0,0 +1,23 @@
+#include <csvbuffer/csvpipebuffer.hpp>
+#include <algorithm>
+#include <climits>
+
+#include <fcntl.h>
+
+namespace csv {
+
+PipeBuffer::PipeBuffer(int fd, size_t capacity, size_t pipe_size)
+    : FdBuffer(fd, capacity)
+{
+    // best effort, the default 64 KiB pipe works too
+    if (pipe_size != 0) {
+        fcntl(fd, F_SETPIPE_SZ, static_cast<int>(std::min<size_t>(pipe_size, INT_MAX)));
+    }
+}
+
+size_t PipeBuffer::pipe_size() const noexcept {
+    const int size = fcntl(fd(), F_GETPIPE_SZ);
+    return size > 0 ? static_cast<size_t>(size) : 0;
+}
+
+}
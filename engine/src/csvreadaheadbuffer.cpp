@@ -0,0 +1,228 @@
+#include <csvbuffer/csvreadaheadbuffer.hpp>
+#include <algorithm>
+#include <cstring>
+
+namespace csv {
+
+ReadAheadBuffer::ReadAheadBuffer(std::unique_ptr<IBuffer> source, size_t block_size, size_t max_capacity)
+    : source_(std::move(source))
+    , block_size_(std::max<size_t>(block_size, 1))
+    , max_capacity_(std::max(max_capacity, block_size_))
+    , capacity_(block_size_)
+    , data_(std::make_unique<char[]>(block_size_))
+{
+    if (!source_) {
+        throw BufferError();
+    }
+
+    for (auto& block : blocks_) {
+        block.data = std::make_unique<char[]>(block_size_);
+    }
+
+    start();
+}
+
+ReadAheadBuffer::~ReadAheadBuffer() {
+    stop();
+}
+
+void ReadAheadBuffer::start() {
+    for (auto& block : blocks_) {
+        block.length = 0;
+        block.pos = 0;
+        block.end = ReadingResult::ok;
+        block.full.store(false, std::memory_order_relaxed);
+    }
+    current_ = 0;
+    finished_ = false;
+    failed_ = false;
+    stopping_.store(false, std::memory_order_relaxed);
+
+    io_thread_ = std::thread([this] { fill_blocks(); });
+}
+
+void ReadAheadBuffer::interrupt() noexcept {
+    // the failed read ends the I/O thread's block, which wakes a refill() waiting for it
+    source_->interrupt();
+}
+
+bool ReadAheadBuffer::may_block() const noexcept {
+    return source_->may_block();
+}
+
+void ReadAheadBuffer::stop() noexcept {
+    if (!io_thread_.joinable()) {
+        return;
+    }
+
+    stopping_.store(true, std::memory_order_release);
+    // wake the thread if it waits in a read of the source or for the parser to drain a block
+    source_->interrupt();
+    for (auto& block : blocks_) {
+        block.full.store(false, std::memory_order_release);
+        block.full.notify_one();
+    }
+    io_thread_.join();
+}
+
+// I/O thread: fills blocks 0, 1, 0, ... waiting until the parser gives each one back
+void ReadAheadBuffer::fill_blocks() noexcept {
+    size_t index = 0;
+    const bool may_block = source_->may_block();
+
+    while (!stopping_.load(std::memory_order_acquire)) {
+        Block& block = blocks_[index];
+        block.full.wait(true, std::memory_order_acquire);
+        if (stopping_.load(std::memory_order_acquire)) {
+            return;
+        }
+
+        block.length = 0;
+        block.pos = 0;
+        block.end = ReadingResult::ok;
+
+        // a file fills the whole block; a source that may block hands it over once it has nothing
+        // buffered: the next refill() may wait for a pipe writer, which may not write more until
+        // the records read so far were parsed
+        while (block.length < block_size_) {
+            if (source_->empty()) {
+                if (block.length > 0 && may_block) {
+                    break;
+                }
+                auto result = source_->refill();
+                if (result == ReadingResult::eof || result == ReadingResult::fail) {
+                    block.end = result;
+                    break;
+                }
+                if (result != ReadingResult::ok) {
+                    block.end = ReadingResult::fail;
+                    break;
+                }
+            }
+
+            auto data = source_->view();
+            const size_t bytes = std::min(data.size(), block_size_ - block.length);
+            std::memcpy(block.data.get() + block.length, data.data(), bytes);
+            source_->consume(bytes);
+            block.length += bytes;
+        }
+
+        block.full.store(true, std::memory_order_release);
+        block.full.notify_one();
+
+        if (block.end != ReadingResult::ok) {
+            return;
+        }
+        index ^= 1;
+    }
+}
+
+void ReadAheadBuffer::resize(size_t new_capacity) {
+    auto data = std::make_unique<char[]>(new_capacity);
+    const size_t leftover = available();
+    std::memcpy(data.get(), data_.get() + start_, leftover);
+
+    data_ = std::move(data);
+    capacity_ = new_capacity;
+    start_ = 0;
+    size_ = leftover;
+}
+
+ReadingResult ReadAheadBuffer::refill() {
+    if (failed_) {
+        return ReadingResult::fail;
+    }
+
+    // the long record is gone, go back to the normal window while at least half of it stays free
+    if (capacity_ > block_size_ && available() <= block_size_ / 2) {
+        resize(block_size_);
+    }
+    else {
+        compact_window(data_.get(), start_, size_);
+    }
+
+    if (size_ == capacity_) {
+        if (capacity_ >= max_capacity_) {
+            return ReadingResult::buffer_full;
+        }
+        resize(capacity_ > max_capacity_ / 2 ? max_capacity_ : capacity_ * 2);
+    }
+
+    bool copied = false;
+    while (size_ < capacity_ && !finished_) {
+        Block& block = blocks_[current_];
+
+        // once the window has new data, only take a block the thread already finished
+        if (copied && !block.full.load(std::memory_order_acquire)) {
+            break;
+        }
+        block.full.wait(false, std::memory_order_acquire);
+
+        const size_t bytes = std::min(block.length - block.pos, capacity_ - size_);
+        std::memcpy(data_.get() + size_, block.data.get() + block.pos, bytes);
+        size_ += bytes;
+        block.pos += bytes;
+        copied = copied || bytes > 0;
+
+        if (block.pos == block.length) {
+            if (block.end != ReadingResult::ok) {
+                finished_ = true;
+                failed_ = block.end == ReadingResult::fail;
+                break;
+            }
+            // hand the drained block back to the I/O thread
+            block.full.store(false, std::memory_order_release);
+            block.full.notify_one();
+            current_ ^= 1;
+        }
+    }
+
+    if (copied) {
+        return ReadingResult::ok;
+    }
+    return failed_ ? ReadingResult::fail : ReadingResult::eof;
+}
+
+std::string_view ReadAheadBuffer::view() const noexcept {
+    return {data_.get() + start_, available()};
+}
+
+void ReadAheadBuffer::consume(size_t bytes) noexcept {
+    start_ += std::min(bytes, available());
+}
+
+size_t ReadAheadBuffer::available() const noexcept {
+    return size_ - start_;
+}
+
+size_t ReadAheadBuffer::capacity() const noexcept {
+    return capacity_;
+}
+
+bool ReadAheadBuffer::empty() const noexcept {
+    return start_ == size_;
+}
+
+bool ReadAheadBuffer::eof() const noexcept {
+    return empty() && finished_ && !failed_;
+}
+
+bool ReadAheadBuffer::good() const noexcept {
+    return !failed_ && !(finished_ && empty());
+}
+
+bool ReadAheadBuffer::reset() {
+    stop();
+
+    start_ = 0;
+    size_ = 0;
+    if (capacity_ != block_size_) {
+        resize(block_size_);
+    }
+    const bool rewound = source_->reset();
+
+    start();
+    return rewound;
+}
+
+}
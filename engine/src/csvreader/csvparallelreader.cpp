@@ -0,0 +1,311 @@
+#include <csvreader/csvparallelreader.hpp>
+#include <csvreader/csvreadloop.hpp>
+#include <csvparser/csvparser.hpp>
+#include <csvparser/csvsimd.hpp>
+#include <csvbuffer/csvmappedbuffer.hpp>
+#include <csvbuffer/csvmemorybuffer.hpp>
+#include <csvbuffer/csvdecompressingbuffer.hpp>
+#include <csverrors.hpp>
+#include <algorithm>
+#include <bit>
+
+namespace csv {
+
+namespace {
+
+std::unique_ptr<IBuffer> map_file(const std::string& filepath, const Config& config) {
+    auto buffer = make_mapped_buffer(filepath, MappedBuffer::WHOLE_FILE, {
+        .populate = config.mapped_populate,
+        .huge_pages = config.mapped_huge_pages,
+        .prefetch = config.mapped_prefetch,
+    });
+
+    if (detect_compression(buffer->view()) != Compression::none) {
+        throw ConfigError("ParallelReader cannot split compressed input, read it with Reader");
+    }
+    return buffer;
+}
+
+size_t count_quotes(const simd::KernelOps& ops, std::string_view data, char quote) noexcept {
+    size_t quotes = 0;
+    size_t pos = 0;
+    for (; pos + simd::BLOCK_SIZE <= data.size(); pos += simd::BLOCK_SIZE) {
+        quotes += std::popcount(ops.scan(data.data() + pos, quote, quote, quote).quote);
+    }
+    return quotes + static_cast<size_t>(std::count(data.begin() + pos, data.end(), quote));
+}
+
+/// @return position after the first line ending at or after pos, data.size() when there is none
+size_t line_start(std::string_view data, size_t pos, char line_end) noexcept {
+    const size_t found = data.find(line_end, pos);
+    return found == std::string_view::npos ? data.size() : found + 1;
+}
+
+/// @return position after the first line ending at or after pos that is outside quotes, data.size() when there is none
+size_t record_start(std::string_view data, size_t pos, bool in_quotes, char line_end, char quote) noexcept {
+    for (; pos < data.size(); pos++) {
+        if (data[pos] == quote) {
+            in_quotes = !in_quotes;
+        }
+        else if (data[pos] == line_end && !in_quotes) {
+            return pos + 1;
+        }
+    }
+    return data.size();
+}
+
+}
+
+ParallelReader::ParallelReader(const std::string& filepath, const Config& config, size_t threads, size_t chunk_size,
+                               Executor& executor)
+    : ReaderBase<RecordView>(map_file(filepath, config), config)
+    , header_parser_(make_view_parser(config))
+    , executor_(executor)
+    , tasks_(executor)
+{
+    csv_file_path_ = filepath;
+
+    // the header is read on this thread, the workers start behind it
+    init();
+    start(threads, chunk_size);
+}
+
+ParallelReader::~ParallelReader() {
+    stopping_.store(true, std::memory_order_relaxed);
+    tasks_.wait();
+}
+
+std::vector<std::string_view> ParallelReader::split(std::string_view data, size_t chunk_size) const {
+    // lenient quoting reads stray quotes that the quote parity below would take for field delimiters
+    if (config_.has_quoting && config_.parse_mode == Config::ParseMode::lenient) {
+        return data.empty() ? std::vector<std::string_view>{} : std::vector<std::string_view>{data};
+    }
+
+    const char line_end = config_.line_ending == Config::LineEnding::cr ? '\r' : '\n';
+    const size_t raw_chunks = (data.size() + chunk_size - 1) / chunk_size;
+
+    // pass 1: quote parity of every raw chunk, counted by threads_ tasks
+    std::vector<char> odd_quotes(raw_chunks, 0);
+    if (config_.has_quoting && raw_chunks > 1) {
+        const auto& ops = simd::kernel_ops(simd::resolve_kernel(config_.kernel));
+        TaskGroup counting(executor_);
+        for (size_t first = 0; first < std::min(threads_, raw_chunks); first++) {
+            counting.run([&, first] {
+                for (size_t i = first; i < raw_chunks; i += threads_) {
+                    odd_quotes[i] = count_quotes(ops, data.substr(i * chunk_size, chunk_size), config_.quote_char) & 1;
+                }
+            });
+        }
+        counting.wait();
+    }
+
+    // pass 2: the prefix XOR of the parities tells whether a raw boundary falls inside a quoted field,
+    //         each boundary moves to the first line ending outside quotes after it.
+    //         Boundaries a long record already moved past are dropped, the next one starts a chunk again
+    std::vector<std::string_view> chunks;
+    size_t begin = 0;
+    bool in_quotes = false;
+    for (size_t i = 1; i <= raw_chunks && begin < data.size(); i++) {
+        in_quotes ^= odd_quotes[i - 1] != 0;
+
+        if (i < raw_chunks && i * chunk_size <= begin) {
+            continue;
+        }
+        size_t end = data.size();
+        if (i < raw_chunks) {
+            end = config_.has_quoting
+                ? record_start(data, i * chunk_size, in_quotes, line_end, config_.quote_char)
+                : line_start(data, i * chunk_size, line_end);
+        }
+        if (end <= begin) {
+            continue;
+        }
+        chunks.push_back(data.substr(begin, end - begin));
+        begin = end;
+    }
+
+    return chunks;
+}
+
+void ParallelReader::start(size_t threads, size_t chunk_size) {
+    started_ = true;
+    threads_ = threads == 0 ? std::max<size_t>(executor_.concurrency(), 1) : threads;
+
+    const auto ranges = split(buffer_->view(), std::max<size_t>(chunk_size, 1));
+    chunks_ = std::vector<Chunk>(ranges.size());
+    for (size_t i = 0; i < ranges.size(); i++) {
+        chunks_[i].data = ranges[i];
+    }
+
+    threads_ = std::min(threads_, chunks_.size());
+    max_in_flight_ = 2 * threads_;
+
+    while (next_to_parse_ < std::min(max_in_flight_, chunks_.size())) {
+        submit_next_chunk();
+    }
+}
+
+void ParallelReader::submit_next_chunk() {
+    if (next_to_parse_ >= chunks_.size()) {
+        return;
+    }
+
+    Chunk& chunk = chunks_[next_to_parse_++];
+    tasks_.run([this, &chunk] {
+        if (stopping_.load(std::memory_order_relaxed)) {
+            return;
+        }
+
+        try {
+            parse_chunk(chunk);
+        }
+        catch (...) {
+            chunk.error = std::current_exception();
+        }
+
+        {
+            std::lock_guard lock(mutex_);
+            chunk.ready = true;
+        }
+        chunk_ready_.notify_all();
+    });
+}
+
+void ParallelReader::parse_chunk(Chunk& chunk) const {
+    // the record size policy is applied in file order by next()
+    Config config = config_;
+    config.has_header = false;
+    config.record_size_policy = Config::RecordSizePolicy::flexible;
+
+    auto buffer = make_memory_buffer(chunk.data);
+    const IBuffer& input = *buffer;
+    ViewReader reader(std::move(buffer), config);
+
+    RecordBatch batch;
+    while (reader.next_batch(batch)) {
+        if (!batch.empty()) {
+            chunk.batches.push_back(std::move(batch));
+            batch = RecordBatch();
+        }
+    }
+
+    // next_batch() also returns false on a parse failure, which leaves the rest of the chunk unread
+    const bool stopped_early = !input.eof();
+    chunk.failed = stopped_early;
+}
+
+ParallelReader::Chunk* ParallelReader::next_ready_chunk() {
+    while (current_chunk_ < chunks_.size()) {
+        Chunk& chunk = chunks_[current_chunk_];
+        while (true) {
+            {
+                std::lock_guard lock(mutex_);
+                if (chunk.ready) {
+                    break;
+                }
+            }
+            // the chunk may still be queued, parse it (or an earlier one) here instead of waiting.
+            // Only tasks of this reader are run, the executor may hold callbacks of other readers
+            if (tasks_.run_pending_task()) {
+                continue;
+            }
+            std::unique_lock lock(mutex_);
+            chunk_ready_.wait(lock, [&chunk] { return chunk.ready; });
+        }
+
+        if (chunk.error) {
+            std::rethrow_exception(chunk.error);
+        }
+        if (current_batch_ < chunk.batches.size()) {
+            return &chunk;
+        }
+        // like a sequential reader, stop at the record that could not be parsed
+        if (chunk.failed) {
+            return nullptr;
+        }
+        release_chunk(current_chunk_);
+    }
+    return nullptr;
+}
+
+void ParallelReader::release_chunk(size_t index) {
+    std::vector<RecordBatch>().swap(chunks_[index].batches);
+    current_chunk_ = index + 1;
+    current_batch_ = 0;
+    current_row_ = 0;
+
+    // keeps max_in_flight_ chunks parsed or being parsed ahead of the caller
+    submit_next_chunk();
+}
+
+bool ParallelReader::next() {
+    // only the header is read before the workers start
+    if (!started_) {
+        if (!read_records(*buffer_, *header_parser_, [this](std::string_view data) { return header_parser_->parse(data); })) {
+            return false;
+        }
+
+        auto& fields = header_parser_->fields();
+        count_record(fields.size());
+        current_record_.assign(fields);
+        return true;
+    }
+
+    while (Chunk* chunk = next_ready_chunk()) {
+        const RecordBatch& batch = chunk->batches[current_batch_];
+        if (current_row_ < batch.size()) {
+            const auto record = batch[current_row_++];
+
+            fields_.clear();
+            for (size_t i = 0; i < record.size(); i++) {
+                fields_.push_back(record[i]);
+            }
+
+            count_record(fields_.size());
+            current_record_.assign(fields_);
+            return true;
+        }
+
+        current_batch_++;
+        current_row_ = 0;
+    }
+
+    return false;
+}
+
+bool ParallelReader::next_batch(RecordBatch& batch) {
+    batch.clear();
+
+    Chunk* chunk = next_ready_chunk();
+    if (!chunk) {
+        return false;
+    }
+
+    auto& parsed = chunk->batches[current_batch_];
+    if (current_row_ == 0) {
+        batch = std::move(parsed);
+    }
+    else {
+        // next() already took the first records of this batch
+        batch.set_source(chunk->data);
+        for (size_t i = current_row_; i < parsed.size(); i++) {
+            batch.append(parsed[i].fields());
+        }
+    }
+
+    current_batch_++;
+    current_row_ = 0;
+
+    count_records(batch);
+    return true;
+}
+
+size_t ParallelReader::threads() const noexcept {
+    return threads_;
+}
+
+size_t ParallelReader::chunk_count() const noexcept {
+    return chunks_.size();
+}
+
+}
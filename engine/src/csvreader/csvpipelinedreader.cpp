@@ -0,0 +1,185 @@
+#include <csvreader/csvpipelinedreader.hpp>
+#include <csvreader/csvreadloop.hpp>
+#include <csvparser/csvparser.hpp>
+#include <csvbuffer/csvreadaheadbuffer.hpp>
+#include <csverrors.hpp>
+
+namespace csv {
+
+namespace {
+
+// the read stage, unless Config::read_ahead already added it
+std::unique_ptr<IBuffer> with_read_stage(std::unique_ptr<IBuffer> buffer, const Config& config) {
+    if (dynamic_cast<ReadAheadBuffer*>(buffer.get())) {
+        return buffer;
+    }
+    return make_read_ahead_buffer(std::move(buffer), config);
+}
+
+}
+
+PipelinedReader::PipelinedReader(const std::string& filepath, const Config& config, size_t queue_depth)
+    : ReaderBase<RecordView>(filepath, config)
+    , parser_(make_view_parser(config))
+    , filled_(queue_depth)
+    , free_(queue_depth)
+{
+    start();
+}
+
+PipelinedReader::PipelinedReader(std::unique_ptr<std::istream> stream, const Config& config, size_t queue_depth)
+    : ReaderBase<RecordView>(std::move(stream), config)
+    , parser_(make_view_parser(config))
+    , filled_(queue_depth)
+    , free_(queue_depth)
+{
+    start();
+}
+
+PipelinedReader::PipelinedReader(std::unique_ptr<IBuffer> buffer, const Config& config, size_t queue_depth)
+    : ReaderBase<RecordView>(std::move(buffer), config)
+    , parser_(make_view_parser(config))
+    , filled_(queue_depth)
+    , free_(queue_depth)
+{
+    start();
+}
+
+PipelinedReader::~PipelinedReader() {
+    // the queue calls wake the parse thread wherever it waits for the caller,
+    // interrupt() a read of the input that waits for a pipe writer
+    filled_.cancel();
+    free_.close();
+    buffer_->interrupt();
+
+    if (parse_thread_.joinable()) {
+        parse_thread_.join();
+    }
+}
+
+void PipelinedReader::start() {
+    buffer_ = with_read_stage(std::move(buffer_), config_);
+
+    // the header is read on this thread, the parse thread starts behind it
+    init();
+    started_ = true;
+
+    for (size_t i = 0; i < free_.capacity(); i++) {
+        (void)free_.push(RecordBatch());
+    }
+
+    parse_thread_ = std::thread([this] { parse_batches(); });
+}
+
+void PipelinedReader::parse_batches() noexcept {
+    try {
+        RecordBatch batch;
+        while (free_.pop(batch)) {
+            parsed_.clear();
+            if (!read_records(*buffer_, *parser_, [this](std::string_view data) { return parser_->parse_batch(data, parsed_); })) {
+                break;
+            }
+
+            batch.copy_from(parsed_);
+            // last record without a line ending
+            if (!parser_->fields().empty()) {
+                batch.append(parser_->fields());
+            }
+
+            if (!filled_.push(std::move(batch))) {
+                break;
+            }
+        }
+    }
+    catch (...) {
+        error_ = std::current_exception();
+    }
+
+    // a parse failure leaves the rest of the input unread
+    failed_ = buffer_->good();
+    filled_.close();
+}
+
+bool PipelinedReader::next_parsed_batch() {
+    if (done_) {
+        return false;
+    }
+
+    current_.clear();
+    (void)free_.push(std::move(current_));
+    current_row_ = 0;
+
+    if (!filled_.pop(current_)) {
+        current_ = RecordBatch();
+        done_ = true;
+        if (error_) {
+            std::rethrow_exception(error_);
+        }
+        return false;
+    }
+    return true;
+}
+
+bool PipelinedReader::next() {
+    // only the header is read before the parse thread starts
+    if (!started_) {
+        if (!read_records(*buffer_, *parser_, [this](std::string_view data) { return parser_->parse(data); })) {
+            return false;
+        }
+
+        auto& fields = parser_->fields();
+        count_record(fields.size());
+        current_record_.assign(fields);
+        return true;
+    }
+
+    while (current_row_ >= current_.size()) {
+        if (!next_parsed_batch()) {
+            return false;
+        }
+    }
+
+    const auto record = current_[current_row_++];
+    fields_.clear();
+    for (size_t i = 0; i < record.size(); i++) {
+        fields_.push_back(record[i]);
+    }
+
+    count_record(fields_.size());
+    current_record_.assign(fields_);
+    return true;
+}
+
+bool PipelinedReader::next_batch(RecordBatch& batch) {
+    batch.clear();
+
+    // next() already took the first records of the current batch
+    if (current_row_ < current_.size()) {
+        for (; current_row_ < current_.size(); current_row_++) {
+            batch.append(current_[current_row_].fields());
+        }
+        count_records(batch);
+        return true;
+    }
+
+    if (!next_parsed_batch()) {
+        return false;
+    }
+
+    std::swap(batch, current_);
+    current_.clear();
+    current_row_ = 0;
+
+    count_records(batch);
+    return true;
+}
+
+bool PipelinedReader::good() const noexcept {
+    if (!started_) {
+        return ReaderBase<RecordView>::good();
+    }
+    // like the buffer of a sequential reader, a parse failure leaves the input unread but good
+    return !done_ || failed_ || current_row_ < current_.size();
+}
+
+}
@@ -1,4 +1,5 @@
 #include <csvreader/csvreader.hpp>
+#include <csvreader/csvreadloop.hpp>
 #include <csvparser/csvparser.hpp>
 #include <csverrors.hpp>
 #include <csvbuffer/csvstreambuffer.hpp>
@@ -9,80 +10,67 @@
 namespace csv {
 
 Reader::Reader(const std::string& filepath, const Config& config)
+    : Reader(filepath, config, make_parser(config))
+{}
+
+Reader::Reader(std::unique_ptr<std::istream> stream, const Config& config)
+    : Reader(std::move(stream), config, make_parser(config))
+{}
+
+Reader::Reader(std::unique_ptr<IBuffer> buffer, const Config& config)
+    : Reader(std::move(buffer), config, make_parser(config))
+{}
+
+Reader::Reader(const std::string& filepath, const Config& config, std::unique_ptr<Parser<std::string>> parser)
     : ReaderBase<Record>(filepath, config)
-    , parser_(make_parser(config))
+    , parser_(std::move(parser))
 {
     init();
 }
 
-Reader::Reader(std::unique_ptr<std::istream> stream, const Config& config)
+Reader::Reader(std::unique_ptr<std::istream> stream, const Config& config, std::unique_ptr<Parser<std::string>> parser)
     : ReaderBase<Record>(std::move(stream), config)
-    , parser_(make_parser(config))
+    , parser_(std::move(parser))
 {
     init();
 }
 
-Reader::Reader(std::unique_ptr<IBuffer> buffer, const Config& config)
+Reader::Reader(std::unique_ptr<IBuffer> buffer, const Config& config, std::unique_ptr<Parser<std::string>> parser)
     : ReaderBase<Record>(std::move(buffer), config)
-    , parser_(make_parser(config))
+    , parser_(std::move(parser))
 {
     init();
 }
 
 bool Reader::next() {
-    parser_->reset();
-
-    auto save_record = [&, policy = config_.record_size_policy](std::vector<std::string>&& fields) {
-        if (record_size_ == 0) {
-            if (policy == Config::RecordSizePolicy::strict_to_first)
-            {
-                record_size_ = fields.size();
-            }
-        }
-        else {
-            auto expected_size = expected_record_size(fields.size());
-            if (expected_size != fields.size()) {
-                throw RecordSizeError(line_number_, expected_size, fields.size());
-            }
-        }
-        current_record_ = Record(std::move(fields));
-        line_number_++;
-    };
-
-    while (true) {
-        if (buffer_->empty()) {
-            auto refill_result = buffer_->refill();
-
-            if (refill_result == ReadingResult::eof) {
-                auto fields = parser_->fields();
-
-                if (!fields.empty()) {
-                    save_record(std::move(fields));
-                    return true;
-                }
-                return false;
-            }
+    if (!read_records(*buffer_, *parser_, [this](std::string_view data) { return parser_->parse(data); })) {
+        return false;
+    }
 
-            if (refill_result != ReadingResult::ok) {
-                return false;
-            }
-        }
+    auto& fields = parser_->fields();
+    count_record(fields.size());
+    current_record_.assign(fields);
+    return true;
+}
 
-        auto data = buffer_->view();
-        auto result = parser_->parse(data);
-        buffer_->consume(parser_->consumed());
+bool Reader::next_batch(RecordBatch& batch) {
+    batch.clear();
 
-        if (result == ParseStatus::complete) {
-            save_record(std::move(parser_->fields()));
-            return true;
+    // records are owned by the batch, so it is filled across buffer refills
+    while (!batch.full()) {
+        if (!read_records(*buffer_, *parser_, [&](std::string_view data) { return parser_->parse_batch(data, batch); })) {
+            break;
         }
 
-        if (result == ParseStatus::fail) {
-            break;
+        // last record without a line ending
+        if (!parser_->fields().empty()) {
+            batch.append(parser_->fields());
+            parser_->reset();
         }
     }
 
-    return false; // on ParseStatus::fail
+    count_records(batch);
+    return !batch.empty();
 }
 
 }
\ No newline at end of file
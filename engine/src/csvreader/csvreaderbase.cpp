@@ -2,7 +2,13 @@
 #include <csvparser/csvparser.hpp>
 #include <csverrors.hpp>
 #include <csvbuffer/csvstreambuffer.hpp>
+#include <csvbuffer/csvgrowablestreambuffer.hpp>
+#include <csvbuffer/csvringbuffer.hpp>
 #include <csvbuffer/csvmappedbuffer.hpp>
+#include <csvbuffer/csvuringbuffer.hpp>
+#include <csvbuffer/csvfdbuffer.hpp>
+#include <csvbuffer/csvreadaheadbuffer.hpp>
+#include <csvbuffer/csvdecompressingbuffer.hpp>
 #include <optional>
 #include <format>
 
@@ -13,14 +19,33 @@ ReaderBase<RecordType>::ReaderBase(const std::string& filepath, const Config& co
     : csv_file_path_(filepath)
     , config_(config)
 {
+    validate_config();
     create_buffer(filepath);
 }
 
 template <typename RecordType>
 ReaderBase<RecordType>::ReaderBase(std::unique_ptr<std::istream> stream, const Config& config)
-    : buffer_(make_stream_buffer(std::move(stream)))
-    , config_(config)
+    : config_(config)
 {
+    validate_config();
+
+    switch (config_.buffer_kind) {
+        case Config::BufferKind::growable:
+            buffer_ = make_growable_stream_buffer(std::move(stream), config_.buffer_capacity, config_.max_buffer_capacity);
+            break;
+        case Config::BufferKind::ring:
+            buffer_ = make_ring_buffer(std::move(stream), config_.buffer_capacity);
+            break;
+        case Config::BufferKind::stream:
+            buffer_ = make_stream_buffer(std::move(stream));
+            break;
+        default:
+            throw ConfigError("buffer_kind needs a file path, a stream can use stream, growable or ring");
+    }
+
+    if (config_.read_ahead) {
+        buffer_ = make_read_ahead_buffer(std::move(buffer_), config_);
+    }
 }
 
 template <typename RecordType>
@@ -28,12 +53,11 @@ ReaderBase<RecordType>::ReaderBase(std::unique_ptr<IBuffer> buffer, const Config
     : buffer_(std::move(buffer))
     , config_(config)
 {
+    validate_config();
 }
 
 template <typename RecordType>
 void ReaderBase<RecordType>::init() {
-    validate_config();
-
     if (config_.record_size_policy == Config::RecordSizePolicy::strict_to_value) {
         record_size_ = config_.record_size;
     }
@@ -68,11 +92,52 @@ void ReaderBase<RecordType>::read_headers() {
 
 template <typename RecordType>
 void ReaderBase<RecordType>::create_buffer(const std::string& filepath) {
-    if (config_.mapped_buffer) {
-        buffer_ = make_mapped_buffer(filepath);
+    // mapped_buffer predates buffer_kind
+    const auto kind = config_.mapped_buffer ? Config::BufferKind::mapped : config_.buffer_kind;
+    switch (kind) {
+        case Config::BufferKind::mapped:
+            buffer_ = make_mapped_buffer(filepath, config_.mapped_window, {
+                .populate = config_.mapped_populate,
+                .huge_pages = config_.mapped_huge_pages,
+                .prefetch = config_.mapped_prefetch,
+            });
+            break;
+        case Config::BufferKind::uring:
+            buffer_ = make_uring_buffer(filepath);
+            break;
+        case Config::BufferKind::fd:
+        case Config::BufferKind::direct_io:
+            buffer_ = make_fd_buffer(filepath, kind == Config::BufferKind::direct_io);
+            break;
+        case Config::BufferKind::growable:
+            buffer_ = make_growable_stream_buffer(filepath, config_.buffer_capacity, config_.max_buffer_capacity);
+            break;
+        case Config::BufferKind::ring:
+            buffer_ = make_ring_buffer(filepath, config_.buffer_capacity);
+            break;
+        case Config::BufferKind::stream:
+            buffer_ = make_stream_buffer(filepath);
+            break;
     }
-    else {
-        buffer_ = make_stream_buffer(filepath);
+
+    // the magic bytes come from the first refill of the file buffer, which then feeds the decoder
+    if (config_.decompress) {
+        // an empty file is rewound, it reads like an unopened one instead of an exhausted one
+        if (buffer_->empty() && buffer_->refill() == ReadingResult::eof) {
+            buffer_->reset();
+        }
+        if (detect_compression(buffer_->view()) != Compression::none) {
+            // the decoder's window neither grows nor wraps around
+            if (kind == Config::BufferKind::growable || kind == Config::BufferKind::ring) {
+                throw ConfigError("compressed input cannot use a growable or ring buffer, set decompress = false to read it raw");
+            }
+            buffer_ = make_decompressing_buffer(std::move(buffer_));
+        }
+    }
+
+    // with read_ahead a compressed file is also inflated on the helper thread
+    if (config_.read_ahead) {
+        buffer_ = make_read_ahead_buffer(std::move(buffer_), config_);
     }
 }
 
@@ -139,6 +204,29 @@ size_t ReaderBase<RecordType>::expected_record_size(size_t record_size) const no
     return record_size_;
 }
 
+template <typename RecordType>
+void ReaderBase<RecordType>::count_record(size_t field_count) {
+    if (record_size_ == 0) {
+        if (config_.record_size_policy == Config::RecordSizePolicy::strict_to_first) {
+            record_size_ = field_count;
+        }
+    }
+    else {
+        auto expected_size = expected_record_size(field_count);
+        if (expected_size != field_count) {
+            throw RecordSizeError(line_number_, expected_size, field_count);
+        }
+    }
+    line_number_++;
+}
+
+template <typename RecordType>
+void ReaderBase<RecordType>::count_records(const RecordBatch& batch) {
+    for (size_t i = 0; i < batch.size(); i++) {
+        count_record(batch[i].size());
+    }
+}
+
 template <typename RecordType>
 ReaderBase<RecordType>::operator bool() const noexcept {
     return good();
@@ -159,6 +247,20 @@ void ReaderBase<RecordType>::validate_config() const {
     if (policy == Config::RecordSizePolicy::strict_to_value && config_.record_size == 0) {
         throw ConfigError("strict_to_value policy requires record_size > 0");
     }
+
+    if (config_.mapped_buffer && config_.buffer_kind != Config::BufferKind::stream &&
+        config_.buffer_kind != Config::BufferKind::mapped) {
+        throw ConfigError("mapped_buffer conflicts with buffer_kind");
+    }
+
+    if (config_.buffer_kind == Config::BufferKind::growable) {
+        if (config_.buffer_capacity == 0) {
+            throw ConfigError("growable buffer requires buffer_capacity > 0");
+        }
+        if (config_.max_buffer_capacity != 0 && config_.max_buffer_capacity < config_.buffer_capacity) {
+            throw ConfigError("max_buffer_capacity must not be smaller than buffer_capacity");
+        }
+    }
 }
 
 template <typename RecordType>
@@ -0,0 +1,174 @@
+#include <csvbuffer/csvringbuffer.hpp>
+#include <algorithm>
+#include <fstream>
+#include <string>
+#include <stdexcept>
+
+#include <sys/mman.h>
+#include <unistd.h>
+
+namespace csv {
+
+namespace {
+
+size_t page_size() {
+    static const size_t size = static_cast<size_t>(sysconf(_SC_PAGESIZE));
+    return size;
+}
+
+std::unique_ptr<std::istream> open_file(std::string_view filename) {
+    auto stream = std::make_unique<std::ifstream>(std::string(filename), std::ios::binary);
+    if (!stream->good()) {
+        throw FileStreamError(filename);
+    }
+    return stream;
+}
+
+}
+
+RingBuffer::RingBuffer(std::string_view filename, size_t capacity)
+    : RingBuffer(open_file(filename), capacity)
+{
+}
+
+RingBuffer::RingBuffer(std::unique_ptr<std::istream> stream, size_t capacity)
+    : stream_(std::move(stream))
+    , capacity_(std::max(page_size(), (capacity + page_size() - 1) / page_size() * page_size()))
+{
+    if (!stream_ || !stream_->good()) {
+        throw FileStreamError();
+    }
+
+    map_ring();
+}
+
+RingBuffer::~RingBuffer() {
+    unmap_ring();
+}
+
+RingBuffer::RingBuffer(RingBuffer&& other) noexcept {
+    *this = std::move(other);
+}
+
+RingBuffer& RingBuffer::operator=(RingBuffer&& other) noexcept {
+    if (this != &other) {
+        unmap_ring();
+
+        stream_ = std::move(other.stream_);
+        capacity_ = other.capacity_;
+        data_ = other.data_;
+        head_ = other.head_;
+        size_ = other.size_;
+
+        other.data_ = nullptr;
+        other.head_ = 0;
+        other.size_ = 0;
+    }
+    return *this;
+}
+
+void RingBuffer::map_ring() {
+    const int fd = memfd_create("csvengine-ring", MFD_CLOEXEC);
+    if (fd == -1) {
+        throw BufferError();
+    }
+
+    if (ftruncate(fd, static_cast<off_t>(capacity_)) == -1) {
+        close(fd);
+        throw BufferError();
+    }
+
+    // reserve both halves at once, then put the same pages into each of them
+    void* base = mmap(nullptr, 2 * capacity_, PROT_NONE, MAP_PRIVATE | MAP_ANONYMOUS, -1, 0);
+    if (base == MAP_FAILED) {
+        close(fd);
+        throw BufferError();
+    }
+
+    char* first = static_cast<char*>(base);
+    const bool mapped =
+        mmap(first, capacity_, PROT_READ | PROT_WRITE, MAP_SHARED | MAP_FIXED, fd, 0) != MAP_FAILED &&
+        mmap(first + capacity_, capacity_, PROT_READ | PROT_WRITE, MAP_SHARED | MAP_FIXED, fd, 0) != MAP_FAILED;
+
+    // the mappings keep the memfd alive
+    close(fd);
+
+    if (!mapped) {
+        munmap(base, 2 * capacity_);
+        throw BufferError();
+    }
+
+    data_ = first;
+}
+
+void RingBuffer::unmap_ring() noexcept {
+    if (data_) {
+        munmap(data_, 2 * capacity_);
+        data_ = nullptr;
+    }
+}
+
+ReadingResult RingBuffer::refill() {
+    if (size_ == capacity_) {
+        return ReadingResult::buffer_full;
+    }
+
+    // back to the first half once per lap; moving the view only here keeps the structural
+    // index of a parsed window valid until the window runs out
+    if (head_ >= capacity_) {
+        head_ -= capacity_;
+    }
+
+    // the free space starts behind the leftover and may wrap into the mirror, it is contiguous either way
+    stream_->read(data_ + head_ + size_, static_cast<std::streamsize>(capacity_ - size_));
+
+    size_t bytes_read = static_cast<size_t>(stream_->gcount());
+
+    if (bytes_read == 0)
+        return stream_->eof() ? ReadingResult::eof : ReadingResult::fail;
+
+    size_ += bytes_read;
+
+    return ReadingResult::ok;
+}
+
+std::string_view RingBuffer::view() const noexcept {
+    if (!data_) return {};
+    return {data_ + head_, size_};
+}
+
+void RingBuffer::consume(size_t bytes) noexcept {
+    bytes = std::min(bytes, size_);
+    size_ -= bytes;
+    head_ += bytes;
+}
+
+size_t RingBuffer::available() const noexcept {
+    return size_;
+}
+
+size_t RingBuffer::capacity() const noexcept {
+    return capacity_;
+}
+
+bool RingBuffer::empty() const noexcept {
+    return size_ == 0;
+}
+
+bool RingBuffer::eof() const noexcept {
+    return size_ == 0 && stream_->eof();
+}
+
+bool RingBuffer::good() const noexcept {
+    return data_ != nullptr && (stream_->good() || !empty());
+}
+
+bool RingBuffer::reset() {
+    stream_->clear();
+    stream_->seekg(0);
+    head_ = 0;
+    size_ = 0;
+    return stream_->good();
+}
+
+}
@@ -0,0 +1,459 @@
+#include <csvbuffer/csvuringbuffer.hpp>
+#include <algorithm>
+#include <atomic>
+#include <cerrno>
+#include <cstdlib>
+#include <cstring>
+#include <string>
+#include <stdexcept>
+
+#include <sys/types.h>
+#include <sys/stat.h>
+#include <sys/mman.h>
+#include <sys/syscall.h>
+#include <fcntl.h>
+#include <unistd.h>
+#include <linux/io_uring.h>
+
+namespace csv {
+
+namespace {
+
+constexpr size_t PAGE_SIZE = 4096;
+
+int io_uring_setup(unsigned entries, io_uring_params* params) {
+    return static_cast<int>(syscall(__NR_io_uring_setup, entries, params));
+}
+
+int io_uring_enter(int ring_fd, unsigned to_submit, unsigned min_complete, unsigned flags) {
+    return static_cast<int>(syscall(__NR_io_uring_enter, ring_fd, to_submit, min_complete, flags, nullptr, 0));
+}
+
+struct FreeDeleter {
+    void operator()(char* ptr) const noexcept { std::free(ptr); }
+};
+
+}
+
+// submission and completion queues shared with the kernel, mapped from the io_uring fd
+struct UringBuffer::Ring {
+    int fd = -1;
+
+    void* sq_ptr = MAP_FAILED;
+    size_t sq_size = 0;
+    void* cq_ptr = MAP_FAILED;
+    size_t cq_size = 0;
+    io_uring_sqe* sqes = static_cast<io_uring_sqe*>(MAP_FAILED);
+    size_t sqes_size = 0;
+
+    unsigned* sq_tail = nullptr;
+    unsigned* sq_mask = nullptr;
+    unsigned* sq_array = nullptr;
+    unsigned* cq_head = nullptr;
+    unsigned* cq_tail = nullptr;
+    unsigned* cq_mask = nullptr;
+    io_uring_cqe* cqes = nullptr;
+
+    /// @return nullptr when the kernel has no io_uring or it is disabled
+    static std::unique_ptr<Ring> create(unsigned entries) {
+        auto ring = std::make_unique<Ring>();
+
+        io_uring_params params{};
+        ring->fd = io_uring_setup(entries, &params);
+        if (ring->fd < 0) {
+            return nullptr;
+        }
+
+        ring->sq_size = params.sq_off.array + params.sq_entries * sizeof(unsigned);
+        ring->cq_size = params.cq_off.cqes + params.cq_entries * sizeof(io_uring_cqe);
+        const bool single_mmap = params.features & IORING_FEAT_SINGLE_MMAP;
+        if (single_mmap) {
+            ring->sq_size = ring->cq_size = std::max(ring->sq_size, ring->cq_size);
+        }
+
+        ring->sq_ptr = mmap(nullptr, ring->sq_size, PROT_READ | PROT_WRITE, MAP_SHARED | MAP_POPULATE, ring->fd, IORING_OFF_SQ_RING);
+        if (ring->sq_ptr == MAP_FAILED) {
+            return nullptr;
+        }
+
+        ring->cq_ptr = single_mmap ? ring->sq_ptr
+                                   : mmap(nullptr, ring->cq_size, PROT_READ | PROT_WRITE, MAP_SHARED | MAP_POPULATE, ring->fd, IORING_OFF_CQ_RING);
+        if (ring->cq_ptr == MAP_FAILED) {
+            return nullptr;
+        }
+
+        ring->sqes_size = params.sq_entries * sizeof(io_uring_sqe);
+        ring->sqes = static_cast<io_uring_sqe*>(
+            mmap(nullptr, ring->sqes_size, PROT_READ | PROT_WRITE, MAP_SHARED | MAP_POPULATE, ring->fd, IORING_OFF_SQES));
+        if (ring->sqes == MAP_FAILED) {
+            return nullptr;
+        }
+
+        char* sq = static_cast<char*>(ring->sq_ptr);
+        ring->sq_tail = reinterpret_cast<unsigned*>(sq + params.sq_off.tail);
+        ring->sq_mask = reinterpret_cast<unsigned*>(sq + params.sq_off.ring_mask);
+        ring->sq_array = reinterpret_cast<unsigned*>(sq + params.sq_off.array);
+
+        char* cq = static_cast<char*>(ring->cq_ptr);
+        ring->cq_head = reinterpret_cast<unsigned*>(cq + params.cq_off.head);
+        ring->cq_tail = reinterpret_cast<unsigned*>(cq + params.cq_off.tail);
+        ring->cq_mask = reinterpret_cast<unsigned*>(cq + params.cq_off.ring_mask);
+        ring->cqes = reinterpret_cast<io_uring_cqe*>(cq + params.cq_off.cqes);
+
+        return ring;
+    }
+
+    ~Ring() {
+        if (sqes != MAP_FAILED) munmap(sqes, sqes_size);
+        if (cq_ptr != MAP_FAILED && cq_ptr != sq_ptr) munmap(cq_ptr, cq_size);
+        if (sq_ptr != MAP_FAILED) munmap(sq_ptr, sq_size);
+        if (fd >= 0) close(fd);
+    }
+
+    bool submit_read(int file_fd, char* destination, unsigned length, uint64_t offset, uint64_t user_data) {
+        // only this thread writes the tail, the kernel reads it
+        const unsigned tail = *sq_tail;
+        const unsigned index = tail & *sq_mask;
+
+        io_uring_sqe& sqe = sqes[index];
+        std::memset(&sqe, 0, sizeof(sqe));
+        sqe.opcode = IORING_OP_READ;
+        sqe.fd = file_fd;
+        sqe.addr = reinterpret_cast<uint64_t>(destination);
+        sqe.len = length;
+        sqe.off = offset;
+        sqe.user_data = user_data;
+
+        sq_array[index] = index;
+        std::atomic_ref<unsigned>(*sq_tail).store(tail + 1, std::memory_order_release);
+
+        int submitted;
+        do {
+            submitted = io_uring_enter(fd, 1, 0, 0);
+        } while (submitted < 0 && errno == EINTR);
+        return submitted == 1;
+    }
+
+    /// @brief calls on_complete(user_data, result) for every finished read,
+    ///        when wait is set blocks until at least one read finishes
+    template <typename OnComplete>
+    bool reap(bool wait, OnComplete on_complete) {
+        unsigned head = *cq_head;
+        unsigned tail = std::atomic_ref<unsigned>(*cq_tail).load(std::memory_order_acquire);
+
+        if (head == tail && wait) {
+            int result;
+            do {
+                result = io_uring_enter(fd, 0, 1, IORING_ENTER_GETEVENTS);
+            } while (result < 0 && errno == EINTR);
+            if (result < 0) {
+                return false;
+            }
+            tail = std::atomic_ref<unsigned>(*cq_tail).load(std::memory_order_acquire);
+        }
+
+        while (head != tail) {
+            const io_uring_cqe& cqe = cqes[head & *cq_mask];
+            on_complete(cqe.user_data, cqe.res);
+            head++;
+        }
+        std::atomic_ref<unsigned>(*cq_head).store(head, std::memory_order_release);
+        return true;
+    }
+};
+
+struct UringBuffer::Block {
+    enum class State { exhausted, pending, in_flight, ready };
+
+    std::unique_ptr<char, FreeDeleter> data;
+    State state = State::exhausted;
+    size_t offset = 0;
+    size_t length = 0;   // requested bytes, then bytes read
+    size_t pos = 0;      // bytes already copied into the window
+};
+
+UringBuffer::UringBuffer(std::string_view filename, size_t block_size, unsigned queue_depth)
+    : block_size_((std::max<size_t>(block_size, 1) + PAGE_SIZE - 1) / PAGE_SIZE * PAGE_SIZE)
+    , data_(std::make_unique<char[]>(block_size_))
+{
+    std::string safe_name(filename);
+
+    fd_ = open(safe_name.c_str(), O_RDONLY | O_CLOEXEC);
+    if (fd_ == -1) {
+        throw FileStreamError(filename);
+    }
+
+    struct stat stat_buff;
+    if (fstat(fd_, &stat_buff) == -1) {
+        close(fd_);
+        throw std::runtime_error("Could not get the file size.");
+    }
+
+    queue_depth = std::max(queue_depth, 1u);
+
+    // io_uring reads need absolute offsets, other files are read in order with read()
+    if (S_ISREG(stat_buff.st_mode)) {
+        file_size_ = static_cast<size_t>(stat_buff.st_size);
+        ring_ = Ring::create(queue_depth);
+        posix_fadvise(fd_, 0, 0, POSIX_FADV_SEQUENTIAL);
+    }
+
+    blocks_.resize(queue_depth);
+    for (auto& block : blocks_) {
+        block.data.reset(static_cast<char*>(std::aligned_alloc(PAGE_SIZE, block_size_)));
+        if (!block.data) {
+            close_all();
+            throw std::bad_alloc();
+        }
+    }
+
+    start_reads();
+}
+
+UringBuffer::~UringBuffer() {
+    close_all();
+}
+
+UringBuffer::UringBuffer(UringBuffer&& other) noexcept {
+    *this = std::move(other);
+}
+
+UringBuffer& UringBuffer::operator=(UringBuffer&& other) noexcept {
+    if (this != &other) {
+        close_all();
+
+        // blocks are heap allocated, reads in flight keep writing to the same memory
+        fd_ = other.fd_;
+        file_size_ = other.file_size_;
+        next_offset_ = other.next_offset_;
+        failed_ = other.failed_;
+        ring_ = std::move(other.ring_);
+        blocks_ = std::move(other.blocks_);
+        head_ = other.head_;
+        block_size_ = other.block_size_;
+        data_ = std::move(other.data_);
+        start_ = other.start_;
+        size_ = other.size_;
+
+        other.fd_ = -1;
+        other.blocks_.clear();
+        other.start_ = 0;
+        other.size_ = 0;
+    }
+    return *this;
+}
+
+void UringBuffer::close_all() noexcept {
+    // the kernel may still write into the blocks
+    wait_all();
+    ring_.reset();
+    blocks_.clear();
+
+    if (fd_ >= 0) {
+        close(fd_);
+        fd_ = -1;
+    }
+}
+
+void UringBuffer::start_reads() {
+    head_ = 0;
+    for (auto& block : blocks_) {
+        submit(block);
+    }
+}
+
+void UringBuffer::submit(Block& block) {
+    block.pos = 0;
+    block.offset = next_offset_;
+
+    if (!ring_) {
+        // read lazily in wait(), a pipe may not have the next block yet
+        block.length = block_size_;
+        block.state = Block::State::pending;
+        return;
+    }
+
+    if (next_offset_ >= file_size_) {
+        block.length = 0;
+        block.state = Block::State::exhausted;
+        return;
+    }
+
+    block.length = std::min(block_size_, file_size_ - next_offset_);
+    next_offset_ += block.length;
+
+    const uint64_t index = static_cast<uint64_t>(&block - blocks_.data());
+    if (ring_->submit_read(fd_, block.data.get(), static_cast<unsigned>(block.length), block.offset, index)) {
+        block.state = Block::State::in_flight;
+    }
+    else {
+        // the ring refused the read, do it now
+        block.state = Block::State::pending;
+    }
+}
+
+void UringBuffer::complete(uint64_t index, int result) {
+    Block& block = blocks_[index];
+
+    if (result < 0) {
+        failed_ = true;
+        block.length = 0;
+    }
+    else if (static_cast<size_t>(result) < block.length) {
+        // short read in the middle of a regular file, fetch the rest synchronously
+        const ssize_t rest = pread(fd_, block.data.get() + result, block.length - result, block.offset + result);
+        if (rest < 0) {
+            failed_ = true;
+        }
+        block.length = static_cast<size_t>(result) + static_cast<size_t>(std::max<ssize_t>(rest, 0));
+    }
+    block.state = Block::State::ready;
+}
+
+bool UringBuffer::wait(Block& block) {
+    auto on_complete = [this](uint64_t index, int result) { complete(index, result); };
+
+    while (block.state == Block::State::in_flight) {
+        if (!ring_->reap(true, on_complete)) {
+            failed_ = true;
+            return false;
+        }
+    }
+
+    if (block.state == Block::State::pending) {
+        ssize_t result;
+        do {
+            result = ring_ ? pread(fd_, block.data.get(), block.length, block.offset)
+                           : read(fd_, block.data.get(), block.length);
+        } while (result < 0 && errno == EINTR);
+
+        if (result < 0) {
+            failed_ = true;
+            return false;
+        }
+        block.length = static_cast<size_t>(result);
+        block.state = result == 0 ? Block::State::exhausted : Block::State::ready;
+    }
+
+    return block.state == Block::State::ready && block.pos < block.length;
+}
+
+void UringBuffer::wait_all() noexcept {
+    if (!ring_) {
+        return;
+    }
+
+    auto in_flight = [this] {
+        return std::any_of(blocks_.begin(), blocks_.end(), [](const Block& block) {
+            return block.state == Block::State::in_flight;
+        });
+    };
+
+    while (in_flight()) {
+        bool reaped = ring_->reap(true, [this](uint64_t index, int) {
+            blocks_[index].state = Block::State::ready;
+        });
+        if (!reaped) {
+            break;
+        }
+    }
+}
+
+ReadingResult UringBuffer::refill() {
+    if (fd_ < 0 || failed_) {
+        return ReadingResult::fail;
+    }
+
+    compact_window(data_.get(), start_, size_);
+
+    if (size_ == block_size_) {
+        return ReadingResult::buffer_full;
+    }
+
+    bool copied = false;
+    while (size_ < block_size_) {
+        Block& block = blocks_[head_];
+
+        // once the window has new data, only take blocks that are already read
+        if (copied) {
+            if (ring_ && block.state == Block::State::in_flight) {
+                ring_->reap(false, [this](uint64_t index, int result) { complete(index, result); });
+            }
+            if (block.state != Block::State::ready) {
+                break;
+            }
+        }
+
+        if (!wait(block)) {
+            break;
+        }
+
+        const size_t bytes = std::min(block.length - block.pos, block_size_ - size_);
+        std::memcpy(data_.get() + size_, block.data.get() + block.pos, bytes);
+        size_ += bytes;
+        block.pos += bytes;
+        copied = true;
+
+        if (block.pos == block.length) {
+            submit(block);
+            head_ = (head_ + 1) % blocks_.size();
+        }
+    }
+
+    if (failed_) {
+        return ReadingResult::fail;
+    }
+    return copied ? ReadingResult::ok : ReadingResult::eof;
+}
+
+std::string_view UringBuffer::view() const noexcept {
+    return {data_.get() + start_, available()};
+}
+
+void UringBuffer::consume(size_t bytes) noexcept {
+    start_ += std::min(bytes, available());
+}
+
+size_t UringBuffer::available() const noexcept {
+    return size_ - start_;
+}
+
+size_t UringBuffer::capacity() const noexcept {
+    return block_size_;
+}
+
+bool UringBuffer::empty() const noexcept {
+    return start_ == size_;
+}
+
+bool UringBuffer::eof() const noexcept {
+    return empty() && !blocks_.empty() && blocks_[head_].state == Block::State::exhausted;
+}
+
+bool UringBuffer::good() const noexcept {
+    return fd_ >= 0 && !failed_;
+}
+
+bool UringBuffer::reset() {
+    if (fd_ < 0) {
+        return false;
+    }
+
+    wait_all();
+    if (lseek(fd_, 0, SEEK_SET) == -1) {
+        return false;
+    }
+
+    failed_ = false;
+    next_offset_ = 0;
+    start_ = 0;
+    size_ = 0;
+    start_reads();
+    return true;
+}
+
+bool UringBuffer::asynchronous() const noexcept {
+    return ring_ != nullptr;
+}
+
+}
@@ -0,0 +1,259 @@
+#include <gtest/gtest.h>
+#include <csvbuffer/csvdecompressingbuffer.hpp>
+#include <csvbuffer/csvstreambuffer.hpp>
+#include <csvreader/csvreader.hpp>
+#include <testdata.hpp>
+#include <testhelpers.hpp>
+#include <cstdio>
+#include <fstream>
+#include <sstream>
+#include <string>
+
+#ifdef CSVENGINE_HAS_ZLIB
+#include <zlib.h>
+#endif
+
+#ifdef CSVENGINE_HAS_ZSTD
+#include <zstd.h>
+#endif
+
+using namespace csv;
+
+namespace {
+
+const std::string decompressing_temp_filename = "test_decompressing_buffer.csv.gz";
+
+std::unique_ptr<std::istream> make_stream(const std::string& data) {
+    return std::make_unique<std::istringstream>(data);
+}
+
+#ifdef CSVENGINE_HAS_ZLIB
+std::string gzip(const std::string& data) {
+    z_stream stream{};
+    deflateInit2(&stream, Z_DEFAULT_COMPRESSION, Z_DEFLATED, 16 + MAX_WBITS, 8, Z_DEFAULT_STRATEGY);
+
+    std::string compressed(deflateBound(&stream, data.size()), '\0');
+    stream.next_in = reinterpret_cast<Bytef*>(const_cast<char*>(data.data()));
+    stream.avail_in = static_cast<uInt>(data.size());
+    stream.next_out = reinterpret_cast<Bytef*>(compressed.data());
+    stream.avail_out = static_cast<uInt>(compressed.size());
+    deflate(&stream, Z_FINISH);
+
+    compressed.resize(stream.total_out);
+    deflateEnd(&stream);
+    return compressed;
+}
+#endif
+
+}
+
+TEST(DecompressingBufferTest, DetectsMagicBytes) {
+    EXPECT_EQ(detect_compression("\x1f\x8b\x08"), Compression::gzip);
+    EXPECT_EQ(detect_compression("\x28\xb5\x2f\xfd"), Compression::zstd);
+    EXPECT_EQ(detect_compression("\x28\xb5"), Compression::none);
+    EXPECT_EQ(detect_compression("a,b\n"), Compression::none);
+    EXPECT_EQ(detect_compression(""), Compression::none);
+}
+
+TEST(DecompressingBufferTest, PlainStreamIsCopiedThrough) {
+    const auto content = make_content(100000);
+    DecompressingBuffer buffer(make_stream(content), 4096);
+
+    EXPECT_EQ(buffer.compression(), Compression::none);
+    EXPECT_EQ(read_all(buffer, 1000), content);
+    EXPECT_TRUE(buffer.eof());
+}
+
+TEST(DecompressingBufferTest, EmptyStream) {
+    DecompressingBuffer buffer(make_stream(""));
+
+    EXPECT_EQ(buffer.refill(), ReadingResult::eof);
+    EXPECT_TRUE(buffer.eof());
+}
+
+TEST(DecompressingBufferTest, MissingFileThrows) {
+    EXPECT_THROW(DecompressingBuffer("no_such_file.csv.gz"), FileStreamError);
+}
+
+#ifdef CSVENGINE_HAS_ZLIB
+
+TEST(DecompressingBufferTest, InflatesGzipInChunks) {
+    const auto content = make_content(500000);
+    DecompressingBuffer buffer(make_stream(gzip(content)), 4096);
+
+    EXPECT_EQ(buffer.compression(), Compression::gzip);
+    EXPECT_EQ(read_all(buffer, 777), content);
+    EXPECT_TRUE(buffer.eof());
+}
+
+TEST(DecompressingBufferTest, RefillKeepsLeftover) {
+    const auto content = make_content(20000);
+    DecompressingBuffer buffer(make_stream(gzip(content)), 4096);
+
+    ASSERT_EQ(buffer.refill(), ReadingResult::ok);
+    EXPECT_EQ(buffer.available(), 4096u);
+    buffer.consume(4000);
+
+    ASSERT_EQ(buffer.refill(), ReadingResult::ok);
+    EXPECT_EQ(buffer.view(), std::string_view(content).substr(4000, 4096));
+}
+
+TEST(DecompressingBufferTest, FullWindowReportsBufferFull) {
+    DecompressingBuffer buffer(make_stream(gzip(make_content(20000))), 4096);
+
+    ASSERT_EQ(buffer.refill(), ReadingResult::ok);
+    EXPECT_EQ(buffer.refill(), ReadingResult::buffer_full);
+}
+
+TEST(DecompressingBufferTest, ReadsConcatenatedMembers) {
+    const auto first = make_content(10000);
+    const auto second = make_content(30000);
+    DecompressingBuffer buffer(make_stream(gzip(first) + gzip(second)), 4096);
+
+    EXPECT_EQ(read_all(buffer, 4096), first + second);
+}
+
+TEST(DecompressingBufferTest, IgnoresZeroPaddingAfterLastMember) {
+    const auto content = make_content(10000);
+
+    // the padding spans more than one input chunk
+    for (size_t padding : {1u, 512u, 100000u}) {
+        DecompressingBuffer buffer(make_stream(gzip(content) + std::string(padding, '\0')), 4096);
+        EXPECT_EQ(read_all(buffer, 4096), content);
+        EXPECT_TRUE(buffer.eof());
+    }
+}
+
+TEST(DecompressingBufferTest, TruncatedGzipFails) {
+    auto compressed = gzip(make_content(100000));
+    compressed.resize(compressed.size() / 2);
+    DecompressingBuffer buffer(make_stream(compressed), 4096);
+
+    ReadingResult status;
+    while ((status = buffer.refill()) == ReadingResult::ok) {
+        buffer.consume(buffer.available());
+    }
+    EXPECT_EQ(status, ReadingResult::fail);
+    EXPECT_FALSE(buffer.good());
+    EXPECT_FALSE(buffer.eof());
+}
+
+TEST(DecompressingBufferTest, CorruptGzipFails) {
+    auto compressed = gzip(make_content(100000));
+    for (size_t i = 100; i < 200; i++) {
+        compressed[i] = static_cast<char>(compressed[i] ^ 0x5a);
+    }
+    DecompressingBuffer buffer(make_stream(compressed), 4096);
+
+    ReadingResult status;
+    while ((status = buffer.refill()) == ReadingResult::ok) {
+        buffer.consume(buffer.available());
+    }
+    EXPECT_EQ(status, ReadingResult::fail);
+}
+
+TEST(DecompressingBufferTest, ResetRewindsToStart) {
+    const auto content = make_content(100000);
+    DecompressingBuffer buffer(make_stream(gzip(content)), 4096);
+
+    ASSERT_EQ(buffer.refill(), ReadingResult::ok);
+    buffer.consume(1234);
+    ASSERT_TRUE(buffer.reset());
+    EXPECT_EQ(read_all(buffer, 4096), content);
+}
+
+TEST(DecompressingBufferTest, ReadsSourceThatAlreadyHoldsData) {
+    const auto content = make_content(100000);
+    auto source = make_stream_buffer<64>(make_stream(gzip(content)));
+    ASSERT_EQ(source->refill(), ReadingResult::ok);
+
+    DecompressingBuffer buffer(std::move(source), 4096);
+    EXPECT_EQ(buffer.compression(), Compression::gzip);
+    EXPECT_EQ(read_all(buffer, 1000), content);
+    EXPECT_TRUE(buffer.eof());
+}
+
+TEST(DecompressingBufferTest, ReaderInflatesThroughTheConfiguredFileBuffer) {
+    {
+        std::ofstream out(decompressing_temp_filename, std::ios::binary);
+        out << gzip(quoted_csv_data);
+    }
+
+    for (auto kind : {Config::BufferKind::stream, Config::BufferKind::mapped, Config::BufferKind::uring,
+                      Config::BufferKind::fd}) {
+        Reader expected(make_stream(quoted_csv_data));
+        Reader reader(decompressing_temp_filename, {.buffer_kind = kind});
+
+        while (expected.next()) {
+            ASSERT_TRUE(reader.next());
+            EXPECT_EQ(reader.current_record().fields(), expected.current_record().fields());
+        }
+        EXPECT_FALSE(reader.next());
+    }
+
+    std::remove(decompressing_temp_filename.c_str());
+}
+
+TEST(DecompressingBufferTest, GrowableOrRingBufferOverGzipFileIsConfigError) {
+    {
+        std::ofstream out(decompressing_temp_filename, std::ios::binary);
+        out << gzip(simple_csv_data);
+    }
+
+    EXPECT_THROW(Reader(decompressing_temp_filename, {.buffer_kind = Config::BufferKind::growable}), ConfigError);
+    EXPECT_THROW(Reader(decompressing_temp_filename, {.buffer_kind = Config::BufferKind::ring}), ConfigError);
+
+    // read raw, the buffer kind is honoured
+    EXPECT_NO_THROW(Reader(decompressing_temp_filename, {.has_header = false, .buffer_kind = Config::BufferKind::ring, .decompress = false}));
+
+    std::remove(decompressing_temp_filename.c_str());
+}
+
+TEST(DecompressingBufferTest, ReaderDetectsGzipFile) {
+    {
+        std::ofstream out(decompressing_temp_filename, std::ios::binary);
+        out << gzip(quoted_csv_data);
+    }
+
+    for (bool read_ahead : {false, true}) {
+        Reader expected(make_stream(quoted_csv_data));
+        ViewReader reader(decompressing_temp_filename, {.read_ahead = read_ahead});
+
+        while (expected.next()) {
+            ASSERT_TRUE(reader.next());
+            const auto& fields = reader.current_record().fields();
+            EXPECT_EQ(std::vector<std::string>(fields.begin(), fields.end()), expected.current_record().fields());
+        }
+        EXPECT_FALSE(reader.next());
+    }
+
+    std::remove(decompressing_temp_filename.c_str());
+}
+
+#endif
+
+#ifdef CSVENGINE_HAS_ZSTD
+
+TEST(DecompressingBufferTest, InflatesZstdFrames) {
+    const auto first = make_content(300000);
+    const auto second = make_content(1000);
+
+    auto zstd = [](const std::string& data) {
+        std::string compressed(ZSTD_compressBound(data.size()), '\0');
+        compressed.resize(ZSTD_compress(compressed.data(), compressed.size(), data.data(), data.size(), 1));
+        return compressed;
+    };
+
+    DecompressingBuffer buffer(make_stream(zstd(first) + zstd(second)), 4096);
+
+    EXPECT_EQ(buffer.compression(), Compression::zstd);
+    EXPECT_EQ(read_all(buffer, 777), first + second);
+}
+
+#else
+
+TEST(DecompressingBufferTest, ZstdWithoutLibraryThrows) {
+    EXPECT_THROW(DecompressingBuffer(make_stream("\x28\xb5\x2f\xfd" "data")), DecompressionError);
+}
+
+#endif
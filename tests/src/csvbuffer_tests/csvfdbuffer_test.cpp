@@ -0,0 +1,200 @@
+#include <gtest/gtest.h>
+#include <fstream>
+#include <cstdio>
+#include <string>
+#include <memory>
+#include <thread>
+
+#include <sys/stat.h>
+#include <fcntl.h>
+#include <unistd.h>
+
+#include <csvbuffer/csvfdbuffer.hpp>
+#include <csvreader/csvreader.hpp>
+#include <testhelpers.hpp>
+
+using namespace csv;
+const std::string fd_temp_filename = "test_fd_buffer.tmp";
+
+class FdBufferTest : public ::testing::Test {
+protected:
+
+    void SetUp() override {
+        std::remove(fd_temp_filename.c_str());
+    }
+
+    void TearDown() override {
+        std::remove(fd_temp_filename.c_str());
+    }
+};
+
+TEST_F(FdBufferTest, ReadsSmallFile) {
+    create_temp_file(fd_temp_filename, "a,b\n1,2\n");
+    FdBuffer buffer(fd_temp_filename);
+
+    EXPECT_TRUE(buffer.good());
+    EXPECT_TRUE(buffer.empty());
+    ASSERT_EQ(buffer.refill(), ReadingResult::ok);
+    EXPECT_EQ(buffer.view(), "a,b\n1,2\n");
+
+    buffer.consume(8);
+    EXPECT_EQ(buffer.refill(), ReadingResult::eof);
+    EXPECT_TRUE(buffer.eof());
+}
+
+TEST_F(FdBufferTest, EmptyFile) {
+    create_temp_file(fd_temp_filename, "");
+    FdBuffer buffer(fd_temp_filename);
+
+    EXPECT_TRUE(buffer.good());
+    EXPECT_EQ(buffer.refill(), ReadingResult::eof);
+    EXPECT_TRUE(buffer.eof());
+}
+
+TEST_F(FdBufferTest, ReadsWholeFile) {
+    const auto content = make_content(200 * 1024 + 123);
+    create_temp_file(fd_temp_filename, content);
+
+    for (size_t capacity : {1u, 100u, 4096u}) {
+        FdBuffer buffer(fd_temp_filename, capacity);
+        EXPECT_EQ(buffer.capacity(), capacity);
+        EXPECT_EQ(read_all(buffer, 1000), content);
+    }
+}
+
+TEST_F(FdBufferTest, RefillKeepsLeftover) {
+    const auto content = make_content(3 * 4096);
+    create_temp_file(fd_temp_filename, content);
+    FdBuffer buffer(fd_temp_filename, 4096);
+
+    ASSERT_EQ(buffer.refill(), ReadingResult::ok);
+    buffer.consume(4000);
+    ASSERT_EQ(buffer.refill(), ReadingResult::ok);
+
+    EXPECT_EQ(buffer.available(), 4096u);
+    EXPECT_EQ(buffer.view(), std::string_view(content).substr(4000, 4096));
+}
+
+TEST_F(FdBufferTest, FullWindowReportsBufferFull) {
+    create_temp_file(fd_temp_filename, make_content(3 * 4096));
+    FdBuffer buffer(fd_temp_filename, 4096);
+
+    ASSERT_EQ(buffer.refill(), ReadingResult::ok);
+    EXPECT_EQ(buffer.refill(), ReadingResult::buffer_full);
+}
+
+TEST_F(FdBufferTest, ResetRewindsToStart) {
+    const auto content = make_content(10000);
+    create_temp_file(fd_temp_filename, content);
+    FdBuffer buffer(fd_temp_filename, 4096);
+
+    EXPECT_EQ(read_all(buffer, 333), content);
+    ASSERT_TRUE(buffer.reset());
+    EXPECT_EQ(read_all(buffer, 4096), content);
+}
+
+TEST_F(FdBufferTest, MoveKeepsPosition) {
+    const auto content = make_content(50000);
+    create_temp_file(fd_temp_filename, content);
+
+    FdBuffer first(fd_temp_filename, 4096);
+    ASSERT_EQ(first.refill(), ReadingResult::ok);
+    first.consume(100);
+
+    FdBuffer second(std::move(first));
+    EXPECT_EQ(read_all(second, 4096), content.substr(100));
+}
+
+TEST_F(FdBufferTest, MissingFileThrows) {
+    EXPECT_THROW(FdBuffer("no_such_file.csv"), FileStreamError);
+}
+
+TEST_F(FdBufferTest, ReadsOpenDescriptorWithoutClosingIt) {
+    const auto content = make_content(100 * 1024);
+    create_temp_file(fd_temp_filename, content);
+    const int fd = open(fd_temp_filename.c_str(), O_RDONLY);
+    ASSERT_GE(fd, 0);
+
+    {
+        FdBuffer buffer(fd, 4096);
+        EXPECT_EQ(read_all(buffer, 1000), content);
+        EXPECT_FALSE(buffer.good());
+        EXPECT_TRUE(buffer.reset());
+    }
+
+    EXPECT_NE(fcntl(fd, F_GETFL), -1);
+    close(fd);
+    EXPECT_THROW(FdBuffer closed(fd), FileStreamError);
+}
+
+TEST_F(FdBufferTest, DirectIoReadsWholeFile) {
+    // not a multiple of the alignment, the last read is short
+    const auto content = make_content(100 * 1024 + 77);
+    create_temp_file(fd_temp_filename, content);
+
+    // O_DIRECT or its buffered fallback, the data is the same
+    FdBuffer buffer(fd_temp_filename, 3 * FdBuffer::DIRECT_IO_ALIGNMENT, true);
+    EXPECT_EQ(buffer.capacity(), 3 * FdBuffer::DIRECT_IO_ALIGNMENT);
+    EXPECT_EQ(read_all(buffer, 1000), content);
+
+    ASSERT_TRUE(buffer.reset());
+    EXPECT_EQ(read_all(buffer, 333), content);
+}
+
+TEST_F(FdBufferTest, DirectIoKeepsLeftoverBeforeAlignedBlock) {
+    const auto content = make_content(64 * 1024);
+    create_temp_file(fd_temp_filename, content);
+    FdBuffer buffer(fd_temp_filename, 2 * FdBuffer::DIRECT_IO_ALIGNMENT, true);
+
+    ASSERT_EQ(buffer.refill(), ReadingResult::ok);
+    const size_t first = buffer.available();
+    buffer.consume(first - 10);
+    ASSERT_EQ(buffer.refill(), ReadingResult::ok);
+
+    EXPECT_EQ(buffer.view(), std::string_view(content).substr(first - 10, buffer.available()));
+    EXPECT_GT(buffer.available(), 10u);
+}
+
+TEST_F(FdBufferTest, DirectIoRoundsCapacityUp) {
+    create_temp_file(fd_temp_filename, "a,b\n");
+    FdBuffer buffer(fd_temp_filename, 100, true);
+    EXPECT_EQ(buffer.capacity(), 2 * FdBuffer::DIRECT_IO_ALIGNMENT);
+}
+
+TEST_F(FdBufferTest, ReadsFifo) {
+    const auto content = make_content(20000);
+    ASSERT_EQ(mkfifo(fd_temp_filename.c_str(), 0600), 0);
+
+    std::thread writer([&] {
+        std::ofstream out(fd_temp_filename, std::ios::binary);
+        out << content;
+    });
+
+    FdBuffer buffer(fd_temp_filename, 4096);
+    EXPECT_EQ(read_all(buffer, 4096), content);
+    writer.join();
+}
+
+TEST_F(FdBufferTest, ReaderOverFdBuffer) {
+    const auto content = "h1,h2\n" + make_content(100000);
+    create_temp_file(fd_temp_filename, content);
+
+    Reader expected(std::make_unique<std::istringstream>(content));
+    Reader reader(std::make_unique<FdBuffer>(fd_temp_filename, 4096, true));
+
+    while (expected.next()) {
+        ASSERT_TRUE(reader.next());
+        EXPECT_EQ(reader.current_record().fields(), expected.current_record().fields());
+    }
+    EXPECT_FALSE(reader.next());
+}
+
+TEST_F(FdBufferTest, ReaderSelectsFdBufferFromConfig) {
+    create_temp_file(fd_temp_filename, "a,b\n1,2\n");
+
+    for (Config config : {Config{.buffer_kind = Config::BufferKind::fd}, Config{.buffer_kind = Config::BufferKind::direct_io}}) {
+        Reader reader(fd_temp_filename, config);
+        ASSERT_TRUE(reader.next());
+        EXPECT_EQ(reader.current_record().fields(), (std::vector<std::string>{"1", "2"}));
+    }
+}
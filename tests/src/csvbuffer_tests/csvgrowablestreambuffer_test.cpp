@@ -0,0 +1,163 @@
+#include <gtest/gtest.h>
+#include <csvbuffer/csvgrowablestreambuffer.hpp>
+#include <csvreader/csvreader.hpp>
+#include <testdata.hpp>
+#include <sstream>
+#include <string>
+
+using namespace csv;
+
+namespace {
+
+std::unique_ptr<std::istream> make_stream(const std::string& data) {
+    return std::make_unique<std::istringstream>(data);
+}
+
+std::string huge_cell_csv(size_t cell_size) {
+    return "id,payload\n1,small\n2,\"" + std::string(cell_size, 'x') + "\"\n3,small again\n4,tail\n";
+}
+
+}
+
+TEST(GrowableStreamBufferTest, ReadsInChunksOfInitialCapacity) {
+    GrowableStreamBuffer buffer(make_stream(simple_csv_data), 40);
+
+    EXPECT_TRUE(buffer.good());
+    EXPECT_EQ(buffer.capacity(), 40u);
+
+    std::string result;
+    while (buffer.refill() == ReadingResult::ok) {
+        EXPECT_LE(buffer.available(), 40u);
+        result += buffer.view();
+        buffer.consume(buffer.available());
+    }
+
+    EXPECT_EQ(result, simple_csv_data);
+    EXPECT_TRUE(buffer.eof());
+    EXPECT_EQ(buffer.capacity(), 40u);
+}
+
+TEST(GrowableStreamBufferTest, EmptyStream) {
+    GrowableStreamBuffer buffer(make_stream(""));
+
+    EXPECT_EQ(buffer.refill(), ReadingResult::eof);
+    EXPECT_TRUE(buffer.eof());
+    EXPECT_EQ(buffer.capacity(), DEFAULT_CAPACITY);
+}
+
+TEST(GrowableStreamBufferTest, FullWindowGrowsGeometrically) {
+    const std::string data(1000, 'a');
+    GrowableStreamBuffer buffer(make_stream(data), 16);
+
+    ASSERT_EQ(buffer.refill(), ReadingResult::ok);
+    EXPECT_EQ(buffer.available(), 16u);
+
+    // nothing consumed, the window doubles and keeps the leftover
+    ASSERT_EQ(buffer.refill(), ReadingResult::ok);
+    EXPECT_EQ(buffer.capacity(), 32u);
+    EXPECT_EQ(buffer.available(), 32u);
+
+    ASSERT_EQ(buffer.refill(), ReadingResult::ok);
+    EXPECT_EQ(buffer.capacity(), 64u);
+    EXPECT_EQ(buffer.view(), std::string_view(data).substr(0, 64));
+}
+
+TEST(GrowableStreamBufferTest, ShrinksBackAfterOutlier) {
+    const std::string data(1000, 'a');
+    GrowableStreamBuffer buffer(make_stream(data), 16);
+
+    for (int i = 0; i < 4; i++) {
+        ASSERT_EQ(buffer.refill(), ReadingResult::ok);
+    }
+    ASSERT_EQ(buffer.capacity(), 128u);
+
+    // the leftover still does not fit the normal window
+    buffer.consume(buffer.available() - 12);
+    ASSERT_EQ(buffer.refill(), ReadingResult::ok);
+    EXPECT_EQ(buffer.capacity(), 128u);
+
+    buffer.consume(buffer.available() - 8);
+    ASSERT_EQ(buffer.refill(), ReadingResult::ok);
+    EXPECT_EQ(buffer.capacity(), 16u);
+    EXPECT_EQ(buffer.available(), 16u);
+}
+
+TEST(GrowableStreamBufferTest, MaxCapacityReportsBufferFull) {
+    const std::string data(1000, 'a');
+    GrowableStreamBuffer buffer(make_stream(data), 16, 48);
+
+    ASSERT_EQ(buffer.refill(), ReadingResult::ok);
+    ASSERT_EQ(buffer.refill(), ReadingResult::ok);
+    ASSERT_EQ(buffer.refill(), ReadingResult::ok);
+    EXPECT_EQ(buffer.capacity(), 48u);
+    EXPECT_EQ(buffer.refill(), ReadingResult::buffer_full);
+}
+
+TEST(GrowableStreamBufferTest, ResetRestoresInitialCapacity) {
+    const std::string data(1000, 'a');
+    GrowableStreamBuffer buffer(make_stream(data), 16);
+
+    ASSERT_EQ(buffer.refill(), ReadingResult::ok);
+    ASSERT_EQ(buffer.refill(), ReadingResult::ok);
+    ASSERT_EQ(buffer.capacity(), 32u);
+
+    ASSERT_TRUE(buffer.reset());
+    EXPECT_EQ(buffer.capacity(), 16u);
+    ASSERT_EQ(buffer.refill(), ReadingResult::ok);
+    EXPECT_EQ(buffer.view(), std::string_view(data).substr(0, 16));
+}
+
+TEST(GrowableStreamBufferTest, MissingFileThrows) {
+    EXPECT_THROW(GrowableStreamBuffer("no_such_file.csv"), FileStreamError);
+}
+
+TEST(GrowableStreamBufferTest, ViewReaderReadsRecordLargerThanWindow) {
+    const auto csv = huge_cell_csv(3 * 1024 * 1024);
+
+    ViewReader reader(make_stream(csv), {.buffer_kind = Config::BufferKind::growable});
+    std::vector<std::string> payloads;
+    while (reader.next()) {
+        payloads.emplace_back(reader.current_record()[1]);
+    }
+
+    ASSERT_EQ(payloads.size(), 4u);
+    EXPECT_EQ(payloads[1].size(), 3u * 1024 * 1024);
+    EXPECT_EQ(payloads[2], "small again");
+    EXPECT_EQ(payloads[3], "tail");
+
+    // the fixed StreamBuffer cannot hold it
+    ViewReader fixed(make_stream(csv));
+    EXPECT_THROW({ while (fixed.next()) {} }, RecordTooLargeError);
+}
+
+TEST(GrowableStreamBufferTest, ViewReaderRespectsMaxCapacity) {
+    const auto csv = huge_cell_csv(100 * 1024);
+
+    ViewReader reader(make_stream(csv), {.buffer_kind = Config::BufferKind::growable, .max_buffer_capacity = 64 * 1024});
+    EXPECT_THROW({ while (reader.next()) {} }, RecordTooLargeError);
+}
+
+TEST(GrowableStreamBufferTest, ViewReaderWithReadAheadReadsRecordLargerThanBlock) {
+    const auto csv = huge_cell_csv(200 * 1024);
+
+    ViewReader reader(make_stream(csv), {.buffer_kind = Config::BufferKind::growable, .read_ahead = true});
+    std::vector<std::string> payloads;
+    while (reader.next()) {
+        payloads.emplace_back(reader.current_record()[1]);
+    }
+
+    ASSERT_EQ(payloads.size(), 4u);
+    EXPECT_EQ(payloads[1].size(), 200u * 1024);
+    EXPECT_EQ(payloads[3], "tail");
+
+    ViewReader limited(make_stream(csv), {.buffer_kind = Config::BufferKind::growable, .max_buffer_capacity = 64 * 1024, .read_ahead = true});
+    EXPECT_THROW({ while (limited.next()) {} }, RecordTooLargeError);
+}
+
+TEST(GrowableStreamBufferTest, ConfigValidation) {
+    EXPECT_THROW(Reader(make_stream("a\n"), {.buffer_kind = Config::BufferKind::growable, .buffer_capacity = 0}), ConfigError);
+    EXPECT_THROW(Reader(make_stream("a\n"), {.buffer_kind = Config::BufferKind::growable, .buffer_capacity = 1024, .max_buffer_capacity = 512}), ConfigError);
+
+    // checked before the file is opened
+    EXPECT_THROW(Reader("no_such_file.csv", {.buffer_kind = Config::BufferKind::growable, .buffer_capacity = 0}), ConfigError);
+}
@@ -3,8 +3,10 @@
 #include <cstdio>
 #include <string>
 #include <filesystem>
+#include <sstream>
 
 #include <csvbuffer/csvmappedbuffer.hpp>
+#include <csvreader/csvreader.hpp>
 
 using namespace csv;
 const std::string temp_filename = "test_mapped_buffer.tmp";
@@ -165,3 +167,191 @@ TEST_F(MappedBufferTest, LargerFileLogic) {
     buffer.consume(1024 * 1024);
     EXPECT_TRUE(buffer.eof());
 }
+
+TEST_F(MappedBufferTest, WholeFileRefillReportsEof) {
+    create_temp_file("a,b\n1,2");
+    MappedBuffer buffer(temp_filename);
+
+    buffer.consume(4);
+    EXPECT_EQ(buffer.refill(), ReadingResult::eof);
+    EXPECT_EQ(buffer.view(), "1,2");
+}
+
+TEST_F(MappedBufferTest, WindowedReadsWholeFile) {
+    std::string content;
+    for (int i = 0; content.size() < 100000; i++) {
+        content += std::to_string(i) + ",field\n";
+    }
+    create_temp_file(content);
+
+    MappedBuffer buffer(temp_filename, 8192);
+    EXPECT_EQ(buffer.capacity(), 8192u);
+    EXPECT_EQ(buffer.available(), 8192u);
+
+    std::string result;
+    while (true) {
+        if (buffer.empty()) {
+            auto status = buffer.refill();
+            if (status == ReadingResult::eof) break;
+            ASSERT_EQ(status, ReadingResult::ok);
+        }
+        auto view = buffer.view().substr(0, 1000);
+        EXPECT_LE(buffer.available(), 8192u);
+        result += view;
+        buffer.consume(view.size());
+    }
+
+    EXPECT_EQ(result, content);
+    EXPECT_TRUE(buffer.eof());
+}
+
+TEST_F(MappedBufferTest, WindowedRefillKeepsLeftoverContiguous) {
+    std::string content(20000, 'x');
+    for (size_t i = 0; i < content.size(); i++) {
+        content[i] = static_cast<char>('a' + i % 26);
+    }
+    create_temp_file(content);
+
+    MappedBuffer buffer(temp_filename, 8192);
+    buffer.consume(8000);
+    ASSERT_EQ(buffer.refill(), ReadingResult::ok);
+
+    // the window starts at the page holding the leftover
+    EXPECT_EQ(buffer.view(), std::string_view(content).substr(8000, 4096 + 8192 - 8000));
+}
+
+TEST_F(MappedBufferTest, WindowedFullWindowReportsBufferFull) {
+    create_temp_file(std::string(20000, 'x'));
+    MappedBuffer buffer(temp_filename, 8192);
+
+    buffer.consume(100);
+    EXPECT_EQ(buffer.refill(), ReadingResult::buffer_full);
+}
+
+TEST_F(MappedBufferTest, WindowedRoundsWindowToPages) {
+    create_temp_file(std::string(100000, 'x'));
+
+    EXPECT_EQ(MappedBuffer(temp_filename, 1).capacity(), 8192u);
+    EXPECT_EQ(MappedBuffer(temp_filename, 10000).capacity(), 12288u);
+}
+
+TEST_F(MappedBufferTest, WindowedResetRewindsToStart) {
+    const std::string content(20000, 'x');
+    create_temp_file(content + "y");
+    MappedBuffer buffer(temp_filename, 8192);
+
+    while (buffer.refill() != ReadingResult::eof) {
+        buffer.consume(buffer.available());
+    }
+    EXPECT_EQ(buffer.view(), "");
+
+    ASSERT_TRUE(buffer.reset());
+    EXPECT_EQ(buffer.available(), 8192u);
+    EXPECT_EQ(buffer.view().front(), 'x');
+}
+
+TEST_F(MappedBufferTest, ViewReaderOverWindowsMatchesStream) {
+    std::string content = "id,name,comment\n";
+    for (int i = 0; i < 20000; i++) {
+        content += std::to_string(i) + ",name" + std::to_string(i % 13) + ",\"quoted, " + std::to_string(i) + "\"\n";
+    }
+    content += "last,row,without newline";
+    create_temp_file(content);
+
+    Reader expected(std::make_unique<std::istringstream>(content));
+    ViewReader reader(temp_filename, {.buffer_kind = Config::BufferKind::mapped, .mapped_window = 8192});
+
+    while (expected.next()) {
+        ASSERT_TRUE(reader.next());
+        const auto& fields = reader.current_record().fields();
+        EXPECT_EQ(std::vector<std::string>(fields.begin(), fields.end()), expected.current_record().fields());
+    }
+    EXPECT_FALSE(reader.next());
+}
+
+TEST_F(MappedBufferTest, ViewReaderReadsLastRecordWithoutNewline) {
+    create_temp_file("a,b\n1,2");
+
+    ViewReader reader(temp_filename, {.buffer_kind = Config::BufferKind::mapped});
+    ASSERT_TRUE(reader.next());
+    EXPECT_EQ(reader.current_record()[1], "2");
+    EXPECT_FALSE(reader.next());
+}
+
+TEST_F(MappedBufferTest, DeprecatedMappedBufferFlagSelectsMappedBuffer) {
+    create_temp_file("a,b\n1,2\n");
+
+    Config config;
+    config.mapped_buffer = true;
+    ViewReader reader(temp_filename, config);
+    ASSERT_TRUE(reader.next());
+    EXPECT_EQ(reader.current_record()[1], "2");
+
+    config.buffer_kind = Config::BufferKind::mapped;
+    EXPECT_NO_THROW(Reader(temp_filename, config));
+    EXPECT_NO_THROW(Reader(temp_filename, {.mapped_buffer = true, .mapped_window = 4096}));
+
+    config.buffer_kind = Config::BufferKind::fd;
+    EXPECT_THROW(Reader(temp_filename, config), ConfigError);
+}
+
+TEST_F(MappedBufferTest, MappingOptionsReadTheSameContent) {
+    std::string content;
+    for (int i = 0; content.size() < 200000; i++) {
+        content += std::to_string(i) + ",field\n";
+    }
+    create_temp_file(content);
+
+    const MappingOptions variants[] = {
+        {.populate = true},
+        {.huge_pages = true},
+        {.prefetch = 16384},
+        {.prefetch = 1},
+        {.populate = true, .huge_pages = true, .prefetch = 1 << 30},
+    };
+
+    for (const auto& options : variants) {
+        for (size_t window : {MappedBuffer::WHOLE_FILE, size_t{8192}}) {
+            MappedBuffer buffer(temp_filename, window, options);
+
+            std::string result;
+            while (true) {
+                if (buffer.empty()) {
+                    auto status = buffer.refill();
+                    if (status == ReadingResult::eof) break;
+                    ASSERT_EQ(status, ReadingResult::ok);
+                }
+                auto view = buffer.view().substr(0, 1000);
+                result += view;
+                buffer.consume(view.size());
+            }
+            EXPECT_EQ(result, content);
+
+            ASSERT_TRUE(buffer.reset());
+            EXPECT_EQ(buffer.view().substr(0, 8), std::string_view(content).substr(0, 8));
+        }
+    }
+}
+
+TEST_F(MappedBufferTest, ViewReaderWithMappingOptionsFromConfig) {
+    std::string content = "id,name\n";
+    for (int i = 0; i < 20000; i++) {
+        content += std::to_string(i) + ",\"name " + std::to_string(i) + "\"\n";
+    }
+    create_temp_file(content);
+
+    Reader expected(std::make_unique<std::istringstream>(content));
+    ViewReader reader(temp_filename, {
+        .buffer_kind = Config::BufferKind::mapped,
+        .mapped_populate = true,
+        .mapped_huge_pages = true,
+        .mapped_prefetch = 64 * 1024,
+    });
+
+    while (expected.next()) {
+        ASSERT_TRUE(reader.next());
+        const auto& fields = reader.current_record().fields();
+        EXPECT_EQ(std::vector<std::string>(fields.begin(), fields.end()), expected.current_record().fields());
+    }
+    EXPECT_FALSE(reader.next());
+}
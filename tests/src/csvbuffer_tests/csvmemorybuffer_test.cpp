@@ -0,0 +1,116 @@
+#include <gtest/gtest.h>
+#include <csvbuffer/csvmemorybuffer.hpp>
+#include <csvreader/csvreader.hpp>
+#include <csvreader/csvbasicreader.hpp>
+#include <testdata.hpp>
+#include <sstream>
+#include <string>
+#include <vector>
+
+using namespace csv;
+
+namespace {
+
+bool points_into(std::string_view field, std::string_view memory) {
+    return field.data() >= memory.data() && field.data() + field.size() <= memory.data() + memory.size();
+}
+
+}
+
+TEST(MemoryBufferTest, ViewIsTheMemoryItself) {
+    const std::string payload = "a,b\n1,2\n";
+    MemoryBuffer buffer(payload.data(), payload.size());
+
+    EXPECT_TRUE(buffer.good());
+    EXPECT_EQ(buffer.view().data(), payload.data());
+    EXPECT_EQ(buffer.available(), payload.size());
+    EXPECT_EQ(buffer.capacity(), payload.size());
+
+    buffer.consume(4);
+    EXPECT_EQ(buffer.view(), "1,2\n");
+    EXPECT_EQ(buffer.refill(), ReadingResult::eof);
+    EXPECT_EQ(buffer.view(), "1,2\n");
+
+    buffer.consume(100);
+    EXPECT_TRUE(buffer.empty());
+    EXPECT_TRUE(buffer.eof());
+    EXPECT_FALSE(buffer.good());
+
+    ASSERT_TRUE(buffer.reset());
+    EXPECT_EQ(buffer.view(), payload);
+}
+
+TEST(MemoryBufferTest, EmptyMemoryIsNotGood) {
+    MemoryBuffer buffer(nullptr, 0);
+
+    EXPECT_TRUE(buffer.eof());
+    EXPECT_FALSE(buffer.good());
+    EXPECT_THROW(Reader(make_memory_buffer("")), BufferError);
+}
+
+TEST(MemoryBufferTest, ReaderMatchesStreamReader) {
+    for (bool quoting : {true, false}) {
+        Config config{.has_quoting = quoting, .record_size_policy = Config::RecordSizePolicy::flexible};
+        Reader expected(std::make_unique<std::istringstream>(quoted_csv_data), config);
+        Reader reader(make_memory_buffer(quoted_csv_data), config);
+
+        EXPECT_EQ(reader.headers(), expected.headers());
+        while (expected.next()) {
+            ASSERT_TRUE(reader.next());
+            EXPECT_EQ(reader.current_record().fields(), expected.current_record().fields());
+        }
+        EXPECT_FALSE(reader.next());
+    }
+}
+
+TEST(MemoryBufferTest, LastRecordWithoutNewline) {
+    const std::string payload = "a,b\n1,2\n3,4";
+    ViewReader reader(make_memory_buffer(payload));
+
+    ASSERT_TRUE(reader.next());
+    ASSERT_TRUE(reader.next());
+    EXPECT_EQ(reader.current_record()[0], "3");
+    EXPECT_EQ(reader.current_record()[1], "4");
+    EXPECT_FALSE(reader.next());
+}
+
+TEST(MemoryBufferTest, ViewReaderFieldsOutliveLaterReads) {
+    std::string payload = "id,name\n";
+    for (int i = 0; i < 10000; i++) {
+        payload += std::to_string(i) + ",name" + std::to_string(i) + "\n";
+    }
+
+    ViewReader reader(make_memory_buffer(payload), {.has_quoting = false});
+    std::vector<std::string_view> names;
+    while (reader.next()) {
+        names.push_back(reader.current_record()[1]);
+    }
+
+    // every field was kept after the reads that followed it, none of them was copied
+    ASSERT_EQ(names.size(), 10000u);
+    for (size_t i = 0; i < names.size(); i++) {
+        EXPECT_TRUE(points_into(names[i], payload));
+        EXPECT_EQ(names[i], "name" + std::to_string(i));
+    }
+}
+
+TEST(MemoryBufferTest, QuotedFieldsWithoutEscapesPointIntoMemory) {
+    const std::string payload = "a,b\n\"x,y\",2\n";
+    ViewReader reader(make_memory_buffer(payload));
+
+    ASSERT_TRUE(reader.next());
+    EXPECT_EQ(reader.current_record()[0], "x,y");
+    EXPECT_TRUE(points_into(reader.current_record()[0], payload));
+}
+
+TEST(MemoryBufferTest, BasicReaderOverMemory) {
+    const std::string payload = "a,b\n1,2\n3,4\n";
+    BasicReader<MemoryBuffer, ViewSimpleParser> reader(std::make_unique<MemoryBuffer>(payload.data(), payload.size()),
+                                                       {.has_quoting = false});
+
+    ASSERT_TRUE(reader.next());
+    EXPECT_EQ(reader.current_record()[0], "1");
+    ASSERT_TRUE(reader.next());
+    EXPECT_EQ(reader.current_record()[1], "4");
+    EXPECT_FALSE(reader.next());
+}
@@ -0,0 +1,166 @@
+#include <gtest/gtest.h>
+#include <csvbuffer/csvpipebuffer.hpp>
+#include <csvreader/csvreader.hpp>
+#include <testdata.hpp>
+#include <testhelpers.hpp>
+#include <chrono>
+#include <cstdio>
+#include <fstream>
+#include <sstream>
+#include <string>
+#include <thread>
+
+#include <fcntl.h>
+#include <unistd.h>
+
+using namespace csv;
+
+class PipeBufferTest : public ::testing::Test {
+protected:
+    int fds_[2] = {-1, -1};
+    std::thread writer_;
+
+    void SetUp() override {
+        ASSERT_EQ(pipe2(fds_, O_CLOEXEC), 0);
+    }
+
+    void TearDown() override {
+        if (writer_.joinable()) writer_.join();
+        if (fds_[0] >= 0) close(fds_[0]);
+        if (fds_[1] >= 0) close(fds_[1]);
+    }
+
+    // writes content from another thread and closes the write end, like a producer process
+    void write_async(std::string content) {
+        writer_ = std::thread([this, content = std::move(content)] {
+            size_t written = 0;
+            while (written < content.size()) {
+                ssize_t bytes = write(fds_[1], content.data() + written, content.size() - written);
+                if (bytes <= 0) break;
+                written += static_cast<size_t>(bytes);
+            }
+            close(fds_[1]);
+            fds_[1] = -1;
+        });
+    }
+
+    std::string read_all(PipeBuffer& buffer) {
+        std::string result;
+        while (true) {
+            auto status = buffer.refill();
+            if (status == ReadingResult::eof) break;
+            if (status != ReadingResult::ok) {
+                ADD_FAILURE() << "refill failed";
+                break;
+            }
+            // keep a leftover, as a parser waiting for the rest of a record does
+            auto view = buffer.view();
+            auto step = view.size() > 10 ? view.size() - 10 : view.size();
+            result += view.substr(0, step);
+            buffer.consume(step);
+        }
+        result += buffer.view();
+        buffer.consume(buffer.available());
+        return result;
+    }
+};
+
+TEST_F(PipeBufferTest, ReadsEverythingWritten) {
+    const auto content = make_content(3 * 1024 * 1024);
+    PipeBuffer buffer(fds_[0], 4096);
+    write_async(content);
+
+    EXPECT_TRUE(buffer.good());
+    EXPECT_EQ(read_all(buffer), content);
+    EXPECT_FALSE(buffer.good());
+}
+
+TEST_F(PipeBufferTest, EnlargesThePipe) {
+    PipeBuffer buffer(fds_[0]);
+    EXPECT_GE(buffer.pipe_size(), PipeBuffer::DEFAULT_PIPE_SIZE);
+
+    PipeBuffer unchanged(fds_[0], 4096, 0);
+    EXPECT_EQ(unchanged.pipe_size(), buffer.pipe_size());
+}
+
+TEST_F(PipeBufferTest, EmptyPipe) {
+    PipeBuffer buffer(fds_[0]);
+    close(fds_[1]);
+    fds_[1] = -1;
+
+    EXPECT_EQ(buffer.refill(), ReadingResult::eof);
+    EXPECT_TRUE(buffer.eof());
+}
+
+TEST_F(PipeBufferTest, FullWindowReportsBufferFull) {
+    PipeBuffer buffer(fds_[0], 16);
+    write_async(make_content(100));
+
+    while (buffer.available() < buffer.capacity()) {
+        ASSERT_EQ(buffer.refill(), ReadingResult::ok);
+    }
+    EXPECT_EQ(buffer.refill(), ReadingResult::buffer_full);
+}
+
+TEST_F(PipeBufferTest, InterruptWakesBlockedRefill) {
+    PipeBuffer buffer(fds_[0]);
+    ASSERT_EQ(write(fds_[1], "a,b\n", 4), 4);
+    ASSERT_EQ(buffer.refill(), ReadingResult::ok);
+    buffer.consume(4);
+
+    // the write end stays open, so the next refill waits for data
+    ReadingResult result = ReadingResult::ok;
+    std::thread reader([&] { result = buffer.refill(); });
+    std::this_thread::sleep_for(std::chrono::milliseconds(20));
+    buffer.interrupt();
+    reader.join();
+
+    EXPECT_EQ(result, ReadingResult::fail);
+    EXPECT_FALSE(buffer.good());
+}
+
+TEST_F(PipeBufferTest, CannotReset) {
+    PipeBuffer buffer(fds_[0]);
+    EXPECT_FALSE(buffer.reset());
+}
+
+TEST_F(PipeBufferTest, InvalidDescriptorThrows) {
+    EXPECT_THROW(PipeBuffer(-1), FileStreamError);
+
+    int closed = dup(fds_[0]);
+    close(closed);
+    EXPECT_THROW(PipeBuffer{closed}, FileStreamError);
+}
+
+TEST_F(PipeBufferTest, ReadsRegularFileDescriptor) {
+    const std::string filename = "test_pipe_buffer.tmp";
+    const auto content = make_content(100000);
+    {
+        std::ofstream out(filename, std::ios::binary);
+        out << content;
+    }
+
+    int fd = open(filename.c_str(), O_RDONLY | O_CLOEXEC);
+    ASSERT_GE(fd, 0);
+    {
+        PipeBuffer buffer(fd, 4096);
+        EXPECT_EQ(buffer.pipe_size(), 0u);
+        EXPECT_EQ(read_all(buffer), content);
+    }
+    close(fd);
+    std::remove(filename.c_str());
+}
+
+TEST_F(PipeBufferTest, ViewReaderMatchesReader) {
+    write_async(quoted_csv_data);
+    ViewReader reader(make_pipe_buffer(fds_[0]));
+    Reader expected(std::make_unique<std::istringstream>(quoted_csv_data));
+
+    EXPECT_EQ(reader.headers(), expected.headers());
+    while (expected.next()) {
+        ASSERT_TRUE(reader.next());
+        const auto& fields = reader.current_record().fields();
+        EXPECT_EQ(std::vector<std::string>(fields.begin(), fields.end()), expected.current_record().fields());
+    }
+    EXPECT_FALSE(reader.next());
+}
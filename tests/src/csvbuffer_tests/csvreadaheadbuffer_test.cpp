@@ -0,0 +1,214 @@
+#include <gtest/gtest.h>
+#include <gmock/gmock.h>
+#include <sstream>
+#include <string>
+#include <memory>
+
+#include <fcntl.h>
+#include <unistd.h>
+
+#include <csvbuffer/csvreadaheadbuffer.hpp>
+#include <csvbuffer/csvstreambuffer.hpp>
+#include <csvbuffer/csvpipebuffer.hpp>
+#include <csvreader/csvreader.hpp>
+#include <csvbuffer_mock.hpp>
+#include <testhelpers.hpp>
+
+using namespace csv;
+using ::testing::NiceMock;
+using ::testing::Return;
+
+class ReadAheadBufferTest : public ::testing::Test {
+protected:
+    std::unique_ptr<IBuffer> make_source(const std::string& content) {
+        return make_stream_buffer<64>(std::make_unique<std::istringstream>(content));
+    }
+};
+
+TEST_F(ReadAheadBufferTest, ReadsSmallSource) {
+    ReadAheadBuffer buffer(make_source("a,b\n1,2\n"));
+
+    EXPECT_TRUE(buffer.good());
+    EXPECT_TRUE(buffer.empty());
+    ASSERT_EQ(buffer.refill(), ReadingResult::ok);
+    EXPECT_EQ(buffer.view(), "a,b\n1,2\n");
+
+    buffer.consume(8);
+    EXPECT_EQ(buffer.refill(), ReadingResult::eof);
+    EXPECT_TRUE(buffer.eof());
+    EXPECT_FALSE(buffer.good());
+}
+
+TEST_F(ReadAheadBufferTest, EmptySource) {
+    ReadAheadBuffer buffer(make_source(""));
+
+    EXPECT_TRUE(buffer.good());
+    EXPECT_EQ(buffer.refill(), ReadingResult::eof);
+    EXPECT_TRUE(buffer.eof());
+}
+
+TEST_F(ReadAheadBufferTest, ReadsManyBlocksInOrder) {
+    const auto content = make_content(100 * 1024 + 123);
+
+    for (size_t block_size : {1u, 7u, 100u, 4096u}) {
+        ReadAheadBuffer buffer(make_source(content), block_size);
+        EXPECT_EQ(buffer.capacity(), block_size);
+        EXPECT_EQ(read_all(buffer, 1000), content);
+    }
+}
+
+TEST_F(ReadAheadBufferTest, RefillKeepsLeftover) {
+    const auto content = make_content(3 * 4096);
+    ReadAheadBuffer buffer(make_source(content), 4096);
+
+    while (buffer.available() < 4096) {
+        ASSERT_EQ(buffer.refill(), ReadingResult::ok);
+    }
+    ASSERT_EQ(buffer.available(), 4096u);
+    buffer.consume(4000);
+    ASSERT_EQ(buffer.refill(), ReadingResult::ok);
+
+    EXPECT_EQ(buffer.view().substr(0, 96), std::string_view(content).substr(4000, 96));
+    EXPECT_EQ(buffer.view(), std::string_view(content).substr(4000, buffer.available()));
+}
+
+TEST_F(ReadAheadBufferTest, FullWindowReportsBufferFull) {
+    ReadAheadBuffer buffer(make_source(make_content(3 * 4096)), 4096);
+
+    while (buffer.available() < 4096) {
+        ASSERT_EQ(buffer.refill(), ReadingResult::ok);
+    }
+    ASSERT_EQ(buffer.available(), 4096u);
+    EXPECT_EQ(buffer.refill(), ReadingResult::buffer_full);
+}
+
+TEST_F(ReadAheadBufferTest, WindowGrowsUpToMaxCapacity) {
+    const auto content = make_content(5 * 4096);
+    ReadAheadBuffer buffer(make_source(content), 4096, 10000);
+
+    for (size_t capacity : {4096u, 8192u, 10000u}) {
+        while (buffer.available() < capacity) {
+            ASSERT_EQ(buffer.refill(), ReadingResult::ok);
+        }
+        EXPECT_EQ(buffer.capacity(), capacity);
+    }
+    EXPECT_EQ(buffer.view(), std::string_view(content).substr(0, 10000));
+    EXPECT_EQ(buffer.refill(), ReadingResult::buffer_full);
+
+    // back to a block once the long record is consumed
+    buffer.consume(10000);
+    ASSERT_EQ(buffer.refill(), ReadingResult::ok);
+    EXPECT_EQ(buffer.capacity(), 4096u);
+    EXPECT_EQ(buffer.view().substr(0, 100), std::string_view(content).substr(10000, 100));
+}
+
+TEST_F(ReadAheadBufferTest, ResetRewindsToStart) {
+    const auto content = make_content(10000);
+    ReadAheadBuffer buffer(make_source(content), 512);
+
+    EXPECT_EQ(read_all(buffer, 333), content);
+    ASSERT_TRUE(buffer.reset());
+    EXPECT_EQ(read_all(buffer, 4096), content);
+}
+
+TEST_F(ReadAheadBufferTest, ResetWhileReading) {
+    const auto content = make_content(10000);
+    ReadAheadBuffer buffer(make_source(content), 512);
+
+    ASSERT_EQ(buffer.refill(), ReadingResult::ok);
+    buffer.consume(100);
+    ASSERT_TRUE(buffer.reset());
+    EXPECT_EQ(read_all(buffer, 4096), content);
+}
+
+TEST_F(ReadAheadBufferTest, DestroyBeforeReadingEverything) {
+    ReadAheadBuffer buffer(make_source(make_content(100000)), 256);
+    ASSERT_EQ(buffer.refill(), ReadingResult::ok);
+}
+
+TEST_F(ReadAheadBufferTest, HandsOverPipeDataWhileWriterIsOpen) {
+    int fds[2];
+    ASSERT_EQ(pipe2(fds, O_CLOEXEC), 0);
+    ASSERT_EQ(write(fds[1], "a,b\n1,2\n", 8), 8);
+
+    {
+        // the I/O thread waits in read() for more data when the buffer is destroyed
+        ReadAheadBuffer buffer(make_pipe_buffer(fds[0]));
+        ASSERT_EQ(buffer.refill(), ReadingResult::ok);
+        EXPECT_EQ(buffer.view(), "a,b\n1,2\n");
+    }
+
+    close(fds[0]);
+    close(fds[1]);
+}
+
+TEST_F(ReadAheadBufferTest, FillsWholeBlocksFromSourceThatCannotBlock) {
+    const auto content = make_content(3 * 4096);
+    ReadAheadBuffer buffer(make_source(content), 4096);
+    EXPECT_FALSE(buffer.may_block());
+
+    // the 64 byte source is drained 64 times into one block before it is handed over
+    ASSERT_EQ(buffer.refill(), ReadingResult::ok);
+    EXPECT_EQ(buffer.view(), content.substr(0, 4096));
+}
+
+TEST_F(ReadAheadBufferTest, PipeSourceMayBlock) {
+    int fds[2];
+    ASSERT_EQ(pipe2(fds, O_CLOEXEC), 0);
+    close(fds[1]);
+
+    ReadAheadBuffer buffer(make_pipe_buffer(fds[0]));
+    EXPECT_TRUE(buffer.may_block());
+    EXPECT_EQ(buffer.refill(), ReadingResult::eof);
+
+    close(fds[0]);
+}
+
+TEST_F(ReadAheadBufferTest, SourceFailureIsReported) {
+    auto source = std::make_unique<NiceMock<MockBuffer>>();
+    ON_CALL(*source, empty()).WillByDefault(Return(true));
+    ON_CALL(*source, refill()).WillByDefault(Return(ReadingResult::fail));
+
+    ReadAheadBuffer buffer(std::move(source));
+    EXPECT_EQ(buffer.refill(), ReadingResult::fail);
+    EXPECT_FALSE(buffer.good());
+    EXPECT_FALSE(buffer.eof());
+}
+
+TEST_F(ReadAheadBufferTest, NullSourceThrows) {
+    EXPECT_THROW(ReadAheadBuffer(nullptr), BufferError);
+}
+
+TEST_F(ReadAheadBufferTest, ReaderRecordsStraddleBlocks) {
+    const auto content = "h1,h2\n" + make_content(50000);
+
+    Reader expected(std::make_unique<std::istringstream>(content));
+    Reader reader(std::make_unique<ReadAheadBuffer>(make_source(content), 100));
+
+    while (expected.next()) {
+        ASSERT_TRUE(reader.next());
+        EXPECT_EQ(reader.current_record().fields(), expected.current_record().fields());
+    }
+    EXPECT_FALSE(reader.next());
+}
+
+TEST_F(ReadAheadBufferTest, ViewReaderRecordsStraddleBlocks) {
+    const auto content = "h1,h2\n" + make_content(50000);
+
+    Reader expected(std::make_unique<std::istringstream>(content));
+    ViewReader reader(std::make_unique<ReadAheadBuffer>(make_source(content), 100));
+
+    while (expected.next()) {
+        ASSERT_TRUE(reader.next());
+        const auto& fields = reader.current_record().fields();
+        EXPECT_EQ(std::vector<std::string>(fields.begin(), fields.end()), expected.current_record().fields());
+    }
+    EXPECT_FALSE(reader.next());
+}
+
+TEST_F(ReadAheadBufferTest, ReaderSelectsReadAheadFromConfig) {
+    Reader reader(std::make_unique<std::istringstream>("a,b\n1,2\n"), {.read_ahead = true});
+    ASSERT_TRUE(reader.next());
+    EXPECT_EQ(reader.current_record().fields(), (std::vector<std::string>{"1", "2"}));
+    EXPECT_FALSE(reader.next());
+}
@@ -0,0 +1,137 @@
+#include <gtest/gtest.h>
+#include <csvbuffer/csvringbuffer.hpp>
+#include <csvreader/csvreader.hpp>
+#include <testdata.hpp>
+#include <testhelpers.hpp>
+#include <sstream>
+#include <string>
+
+#include <unistd.h>
+
+using namespace csv;
+
+namespace {
+
+const size_t page = static_cast<size_t>(sysconf(_SC_PAGESIZE));
+
+std::unique_ptr<std::istream> make_stream(const std::string& data) {
+    return std::make_unique<std::istringstream>(data);
+}
+
+}
+
+TEST(RingBufferTest, ReadsSmallStream) {
+    RingBuffer buffer(make_stream(simple_csv_data));
+
+    EXPECT_TRUE(buffer.good());
+    EXPECT_EQ(buffer.capacity(), page);
+    ASSERT_EQ(buffer.refill(), ReadingResult::ok);
+    EXPECT_EQ(buffer.view(), simple_csv_data);
+
+    buffer.consume(buffer.available());
+    EXPECT_EQ(buffer.refill(), ReadingResult::eof);
+    EXPECT_TRUE(buffer.eof());
+}
+
+TEST(RingBufferTest, EmptyStream) {
+    RingBuffer buffer(make_stream(""));
+
+    EXPECT_EQ(buffer.refill(), ReadingResult::eof);
+    EXPECT_TRUE(buffer.eof());
+}
+
+TEST(RingBufferTest, RefillKeepsLeftoverInPlace) {
+    const auto content = make_content(3 * page);
+    RingBuffer buffer(make_stream(content), page);
+
+    ASSERT_EQ(buffer.refill(), ReadingResult::ok);
+    buffer.consume(page - 100);
+    const char* leftover = buffer.view().data();
+
+    ASSERT_EQ(buffer.refill(), ReadingResult::ok);
+    EXPECT_EQ(buffer.view().data(), leftover);
+    EXPECT_EQ(buffer.available(), page);
+    EXPECT_EQ(buffer.view(), std::string_view(content).substr(page - 100, page));
+}
+
+TEST(RingBufferTest, ViewWrapsAroundContiguously) {
+    const auto content = make_content(4 * page);
+    RingBuffer buffer(make_stream(content), page);
+
+    // step by a size that does not divide the ring, so views keep crossing its end
+    std::string result;
+    while (true) {
+        auto status = buffer.refill();
+        if (status == ReadingResult::eof) break;
+        ASSERT_EQ(status, ReadingResult::ok);
+        EXPECT_EQ(buffer.view(), std::string_view(content).substr(result.size(), buffer.available()));
+
+        auto step = buffer.view().substr(0, 777);
+        result += step;
+        buffer.consume(step.size());
+    }
+    result += buffer.view();
+
+    EXPECT_EQ(result, content);
+}
+
+TEST(RingBufferTest, FullRingReportsBufferFull) {
+    RingBuffer buffer(make_stream(make_content(3 * page)), page);
+
+    ASSERT_EQ(buffer.refill(), ReadingResult::ok);
+    EXPECT_EQ(buffer.refill(), ReadingResult::buffer_full);
+}
+
+TEST(RingBufferTest, ResetRewindsToStart) {
+    const auto content = make_content(3 * page);
+    RingBuffer buffer(make_stream(content), page);
+
+    ASSERT_EQ(buffer.refill(), ReadingResult::ok);
+    buffer.consume(1234);
+    ASSERT_TRUE(buffer.reset());
+    ASSERT_EQ(buffer.refill(), ReadingResult::ok);
+    EXPECT_EQ(buffer.view(), std::string_view(content).substr(0, page));
+}
+
+TEST(RingBufferTest, MoveKeepsPosition) {
+    const auto content = make_content(3 * page);
+    RingBuffer first(make_stream(content), page);
+    ASSERT_EQ(first.refill(), ReadingResult::ok);
+    first.consume(10);
+
+    RingBuffer second(std::move(first));
+    EXPECT_EQ(second.view(), std::string_view(content).substr(10, page - 10));
+    EXPECT_FALSE(first.good());
+}
+
+TEST(RingBufferTest, MissingFileThrows) {
+    EXPECT_THROW(RingBuffer("no_such_file.csv"), FileStreamError);
+}
+
+TEST(RingBufferTest, ViewReaderMatchesReader) {
+    std::string content = "id,name,comment\n";
+    for (int i = 0; i < 5000; i++) {
+        content += std::to_string(i) + ",name" + std::to_string(i % 13) + ",\"quoted, \"\"" + std::to_string(i) + "\"\"\"\n";
+    }
+    content += "last,row,without newline";
+
+    for (bool quoting : {true, false}) {
+        Config config{.has_quoting = quoting, .record_size_policy = Config::RecordSizePolicy::flexible};
+        Reader expected(make_stream(content), config);
+        config.buffer_kind = Config::BufferKind::ring;
+        ViewReader reader(make_stream(content), config);
+
+        while (expected.next()) {
+            ASSERT_TRUE(reader.next());
+            const auto& fields = reader.current_record().fields();
+            EXPECT_EQ(std::vector<std::string>(fields.begin(), fields.end()), expected.current_record().fields());
+        }
+        EXPECT_FALSE(reader.next());
+    }
+}
+
+TEST(RingBufferTest, ReaderSelectsRingBufferFromConfig) {
+    Reader reader(make_stream("a,b\n1,2\n"), {.buffer_kind = Config::BufferKind::ring});
+    ASSERT_TRUE(reader.next());
+    EXPECT_EQ(reader.current_record().fields(), (std::vector<std::string>{"1", "2"}));
+}
@@ -0,0 +1,145 @@
+#include <gtest/gtest.h>
+#include <fstream>
+#include <cstdio>
+#include <string>
+#include <memory>
+#include <thread>
+
+#include <sys/stat.h>
+
+#include <csvbuffer/csvuringbuffer.hpp>
+#include <csvreader/csvreader.hpp>
+#include <testhelpers.hpp>
+
+using namespace csv;
+const std::string uring_temp_filename = "test_uring_buffer.tmp";
+
+class UringBufferTest : public ::testing::Test {
+protected:
+
+    void SetUp() override {
+        std::remove(uring_temp_filename.c_str());
+    }
+
+    void TearDown() override {
+        std::remove(uring_temp_filename.c_str());
+    }
+};
+
+TEST_F(UringBufferTest, ReadsSmallFile) {
+    create_temp_file(uring_temp_filename, "a,b\n1,2\n");
+    UringBuffer buffer(uring_temp_filename);
+
+    EXPECT_TRUE(buffer.good());
+    EXPECT_TRUE(buffer.empty());
+    ASSERT_EQ(buffer.refill(), ReadingResult::ok);
+    EXPECT_EQ(buffer.view(), "a,b\n1,2\n");
+
+    buffer.consume(8);
+    EXPECT_EQ(buffer.refill(), ReadingResult::eof);
+    EXPECT_TRUE(buffer.eof());
+}
+
+TEST_F(UringBufferTest, EmptyFile) {
+    create_temp_file(uring_temp_filename, "");
+    UringBuffer buffer(uring_temp_filename);
+
+    EXPECT_TRUE(buffer.good());
+    EXPECT_EQ(buffer.refill(), ReadingResult::eof);
+}
+
+TEST_F(UringBufferTest, ReadsManyBlocksInOrder) {
+    const auto content = make_content(200 * 1024 + 123);
+    create_temp_file(uring_temp_filename, content);
+
+    for (unsigned depth : {1u, 2u, 4u}) {
+        UringBuffer buffer(uring_temp_filename, 4096, depth);
+        EXPECT_EQ(buffer.capacity(), 4096u);
+        EXPECT_EQ(read_all(buffer, 1000), content);
+    }
+}
+
+TEST_F(UringBufferTest, RefillKeepsLeftover) {
+    const auto content = make_content(3 * 4096);
+    create_temp_file(uring_temp_filename, content);
+    UringBuffer buffer(uring_temp_filename, 4096);
+
+    ASSERT_EQ(buffer.refill(), ReadingResult::ok);
+    buffer.consume(4000);
+    ASSERT_EQ(buffer.refill(), ReadingResult::ok);
+
+    EXPECT_EQ(buffer.available(), 4096u);
+    EXPECT_EQ(buffer.view(), std::string_view(content).substr(4000, 4096));
+}
+
+TEST_F(UringBufferTest, FullWindowReportsBufferFull) {
+    create_temp_file(uring_temp_filename, make_content(3 * 4096));
+    UringBuffer buffer(uring_temp_filename, 4096);
+
+    ASSERT_EQ(buffer.refill(), ReadingResult::ok);
+    EXPECT_EQ(buffer.refill(), ReadingResult::buffer_full);
+}
+
+TEST_F(UringBufferTest, ResetRewindsToStart) {
+    const auto content = make_content(10000);
+    create_temp_file(uring_temp_filename, content);
+    UringBuffer buffer(uring_temp_filename, 4096);
+
+    EXPECT_EQ(read_all(buffer, 333), content);
+    ASSERT_TRUE(buffer.reset());
+    EXPECT_EQ(read_all(buffer, 4096), content);
+}
+
+TEST_F(UringBufferTest, MoveKeepsReadsInFlight) {
+    const auto content = make_content(50000);
+    create_temp_file(uring_temp_filename, content);
+
+    UringBuffer first(uring_temp_filename, 4096);
+    ASSERT_EQ(first.refill(), ReadingResult::ok);
+    auto prefix = std::string(first.view());
+    first.consume(prefix.size());
+
+    UringBuffer second(std::move(first));
+    EXPECT_EQ(prefix + read_all(second, 4096), content);
+}
+
+TEST_F(UringBufferTest, MissingFileThrows) {
+    EXPECT_THROW(UringBuffer("no_such_file.csv"), FileStreamError);
+}
+
+TEST_F(UringBufferTest, ReaderOverUringBuffer) {
+    const auto content = "h1,h2\n" + make_content(100000);
+    create_temp_file(uring_temp_filename, content);
+
+    Reader expected(std::make_unique<std::istringstream>(content));
+    Reader reader(std::make_unique<UringBuffer>(uring_temp_filename, 4096));
+
+    while (expected.next()) {
+        ASSERT_TRUE(reader.next());
+        EXPECT_EQ(reader.current_record().fields(), expected.current_record().fields());
+    }
+    EXPECT_FALSE(reader.next());
+}
+
+TEST_F(UringBufferTest, FifoFallsBackToRead) {
+    const auto content = make_content(20000);
+    ASSERT_EQ(mkfifo(uring_temp_filename.c_str(), 0600), 0);
+
+    std::thread writer([&] {
+        std::ofstream out(uring_temp_filename, std::ios::binary);
+        out << content;
+    });
+
+    UringBuffer buffer(uring_temp_filename, 4096);
+    EXPECT_FALSE(buffer.asynchronous());
+    EXPECT_EQ(read_all(buffer, 4096), content);
+    writer.join();
+}
+
+TEST_F(UringBufferTest, ReaderSelectsUringBufferFromConfig) {
+    create_temp_file(uring_temp_filename, "a,b\n1,2\n");
+
+    Reader reader(uring_temp_filename, {.buffer_kind = Config::BufferKind::uring});
+    ASSERT_TRUE(reader.next());
+    EXPECT_EQ(reader.current_record().fields(), (std::vector<std::string>{"1", "2"}));
+}
@@ -0,0 +1,112 @@
+#include <gtest/gtest.h>
+
+#include <random>
+
+#include <csvparser/csvparser.hpp>
+#include <csvdialect.hpp>
+#include <csvconfig.hpp>
+
+using namespace csv;
+
+using SemicolonCrlfDialect = Dialect<';', '\'', Config::LineEnding::crlf>;
+using LenientCrDialect = Dialect<'|', '"', Config::LineEnding::cr, Config::ParseMode::lenient>;
+
+class DialectParserTest : public ::testing::Test {
+protected:
+    // feeds every chunk to both parsers and expects identical results
+    void ExpectSameParsing(Parser<std::string>& expected, Parser<std::string>& actual, std::string_view data, size_t chunk_size) {
+        while (!data.empty()) {
+            std::string chunk(data.substr(0, chunk_size));
+            std::string_view rest = chunk;
+
+            while (!rest.empty()) {
+                auto expected_status = expected.parse(rest);
+                ASSERT_EQ(actual.parse(rest), expected_status);
+                ASSERT_EQ(actual.consumed(), expected.consumed());
+                ASSERT_EQ(actual.fields(), expected.fields());
+
+                if (expected_status == ParseStatus::fail) return;
+                rest.remove_prefix(expected.consumed());
+                if (expected_status == ParseStatus::complete) {
+                    expected.reset();
+                    actual.reset();
+                }
+            }
+            data.remove_prefix(chunk.size());
+        }
+    }
+
+    std::string random_data(std::string_view alphabet, size_t size, unsigned seed) {
+        std::mt19937 rng(seed);
+        std::string data;
+        for (size_t i = 0; i < size; i++) {
+            data += alphabet[rng() % alphabet.size()];
+        }
+        return data;
+    }
+};
+
+TEST_F(DialectParserTest, ApplyReplacesOnlyDialectOptions) {
+    constexpr Config config = SemicolonCrlfDialect::apply({.has_header = false, .has_quoting = false});
+
+    static_assert(config.delimiter == ';');
+    static_assert(config.quote_char == '\'');
+    static_assert(config.line_ending == Config::LineEnding::crlf);
+    static_assert(config.has_quoting);
+    static_assert(!config.has_header);
+    static_assert(SemicolonCrlfDialect::matches(config));
+    static_assert(!Rfc4180Dialect::matches(config));
+}
+
+TEST_F(DialectParserTest, DerivesFromRuntimeParserOfItsMode) {
+    DialectParser<Rfc4180Dialect> strict;
+    DialectParser<LenientDialect> lenient;
+    DialectParser<TsvDialect> simple;
+
+    EXPECT_NE(dynamic_cast<StrictQuotingParser*>(&strict), nullptr);
+    EXPECT_NE(dynamic_cast<LenientQuotingParser*>(&lenient), nullptr);
+    EXPECT_NE(dynamic_cast<SimpleParser*>(&simple), nullptr);
+}
+
+TEST_F(DialectParserTest, MakeParserSpecializesDefaultLenientDialect) {
+    auto parser = make_parser({.parse_mode = Config::ParseMode::lenient});
+    EXPECT_NE(dynamic_cast<DialectParser<LenientDialect>*>(parser.get()), nullptr);
+
+    auto other = make_parser({.delimiter = ';', .parse_mode = Config::ParseMode::lenient});
+    EXPECT_EQ(dynamic_cast<DialectParser<LenientDialect>*>(other.get()), nullptr);
+}
+
+TEST_F(DialectParserTest, StrictParsesQuotedRecord) {
+    DialectParser<SemicolonCrlfDialect> parser;
+    EXPECT_EQ(parser.parse("'a;b';'it''s'\r\n"), ParseStatus::complete);
+    EXPECT_EQ(parser.fields(), (std::vector<std::string>{"a;b", "it's"}));
+}
+
+TEST_F(DialectParserTest, StrictMatchesRuntimeParser) {
+    const auto data = random_data("ab;'\r\n", 4000, 1);
+    for (size_t chunk_size : {1, 7, 64, 4000}) {
+        for (auto kernel : {Config::Kernel::scalar, Config::Kernel::swar}) {
+            StrictQuotingParser runtime(SemicolonCrlfDialect::apply());
+            DialectParser<SemicolonCrlfDialect> dialect({.kernel = kernel});
+            ExpectSameParsing(runtime, dialect, data, chunk_size);
+        }
+    }
+}
+
+TEST_F(DialectParserTest, LenientMatchesRuntimeParser) {
+    const auto data = random_data("ab|\"\"\r\n", 4000, 2);
+    for (size_t chunk_size : {1, 5, 64, 4000}) {
+        LenientQuotingParser runtime(LenientCrDialect::apply());
+        DialectParser<LenientCrDialect> dialect;
+        ExpectSameParsing(runtime, dialect, data, chunk_size);
+    }
+}
+
+TEST_F(DialectParserTest, SimpleMatchesRuntimeParser) {
+    const auto data = random_data("ab\t\"\n", 4000, 3);
+    for (size_t chunk_size : {1, 9, 4000}) {
+        SimpleParser runtime(TsvDialect::apply());
+        DialectParser<TsvDialect> dialect;
+        ExpectSameParsing(runtime, dialect, data, chunk_size);
+    }
+}
@@ -351,6 +351,20 @@ TEST_F(LenientParserTest, Edge_VeryLongQuotedField) {
     ExpectParse(lenient_parser, input, ParseStatus::complete, {long_field});
 }
 
+TEST_F(LenientParserTest, Edge_ManyFieldsLongerThanScratch) {
+    std::vector<std::string> expected;
+    std::string input;
+    for (size_t i = 0; i < 50; i++) {
+        expected.push_back(std::string(i * 7, 'a') + "\"" + std::to_string(i));
+        input += "\"" + std::string(i * 7, 'a') + "\"\"" + std::to_string(i) + "\",";
+    }
+    expected.push_back("last");
+    input += "last\nnext,record\n";
+
+    ExpectParse(lenient_parser, input, ParseStatus::complete, expected);
+    EXPECT_EQ(lenient_parser->consumed(), input.size() - std::string_view("next,record\n").size());
+}
+
 // ============================================================
 // SPECIFIC LENIENT CASES
 // ============================================================
@@ -708,4 +722,34 @@ TEST_F(LenientParserTest, Quoted_FieldStartsWithDelimiterChar) {
 
 TEST_F(LenientParserTest, Quoted_FieldStartsWithNewlineChar) {
     ExpectParse(lenient_parser, "\"\n\"\n", ParseStatus::complete, {"\n"});
-}
\ No newline at end of file
+}
+// ============================================================
+// Split position must not change the result
+// ============================================================
+
+TEST_F(LenientParserTest, Buffer_Split_BeforeEscapedQuoteInsideQuotes) {
+    EXPECT_EQ(lenient_parser->parse("\"ab"), ParseStatus::need_more_data);
+    EXPECT_EQ(lenient_parser->parse("\"\"c\"\n"), ParseStatus::complete);
+    EXPECT_EQ(lenient_parser->fields(), (std::vector<std::string>{"ab\"c"}));
+}
+
+TEST_F(LenientParserTest, Buffer_Split_BeforeQuoteInsideUnquotedField_QuoteIsLiteral) {
+    EXPECT_EQ(lenient_parser->parse("a"), ParseStatus::need_more_data);
+    EXPECT_EQ(lenient_parser->parse("\"b,c\n"), ParseStatus::complete);
+    EXPECT_EQ(lenient_parser->fields(), (std::vector<std::string>{"a\"b","c"}));
+}
+
+TEST_F(LenientParserTest, Buffer_Split_EveryByte_MatchesSingleBuffer) {
+    const std::string data = "x,\"a,\"\"b\"\"\nc\",\"q\"z,\"\"\"\",end\n";
+
+    ExpectParse(lenient_parser, data, ParseStatus::complete);
+    const auto expected = lenient_parser->fields();
+
+    auto split_parser = make_parser({.parse_mode = Config::ParseMode::lenient});
+    ParseStatus status = ParseStatus::need_more_data;
+    for (char c : data) {
+        status = split_parser->parse(std::string_view(&c, 1));
+    }
+    EXPECT_EQ(status, ParseStatus::complete);
+    EXPECT_EQ(split_parser->fields(), expected);
+}
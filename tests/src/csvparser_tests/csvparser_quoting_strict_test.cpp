@@ -569,4 +569,175 @@ TEST_F(StrictParserTest, Quoted_FieldStartsWithDelimiterChar) {
 
 TEST_F(StrictParserTest, Quoted_FieldStartsWithNewlineChar) {
     ExpectParse(strict_parser, "\"\n\"\n", ParseStatus::complete, {"\n"});
-}
\ No newline at end of file
+}
+
+TEST_F(StrictParserTest, Batch_StopsBeforeIncompleteRecord) {
+    RecordBatch batch;
+    ASSERT_EQ(strict_parser->parse_batch("a,\"b\n\"\nc\nd,\"e", batch), ParseStatus::complete);
+    EXPECT_EQ(strict_parser->consumed(), 9u);
+    ASSERT_EQ(batch.size(), 2u);
+    EXPECT_EQ(batch[0].fields(), (std::vector<std::string_view>{"a", "b\n"}));
+    EXPECT_EQ(batch[1].fields(), (std::vector<std::string_view>{"c"}));
+
+    // no complete record: same as parse(), the partial record is consumed and kept
+    EXPECT_EQ(strict_parser->parse_batch("d,\"e", batch), ParseStatus::need_more_data);
+    EXPECT_EQ(strict_parser->consumed(), 4u);
+    EXPECT_EQ(strict_parser->parse_batch("\"\n", batch), ParseStatus::complete);
+    ASSERT_EQ(batch.size(), 3u);
+    EXPECT_EQ(batch[2].fields(), (std::vector<std::string_view>{"d", "e"}));
+}
+
+TEST_F(StrictParserTest, Batch_StopsAtCapacity) {
+    RecordBatch batch(2);
+    ASSERT_EQ(strict_parser->parse_batch("a\nb\nc\n", batch), ParseStatus::complete);
+    EXPECT_EQ(strict_parser->consumed(), 4u);
+    EXPECT_TRUE(batch.full());
+}
+
+TEST_F(StrictParserTest, Batch_FailureReportedOnNextCall) {
+    RecordBatch batch;
+    std::string_view data = "a\n\"b\"c\n";
+    ASSERT_EQ(strict_parser->parse_batch(data, batch), ParseStatus::complete);
+    EXPECT_EQ(batch.size(), 1u);
+
+    data.remove_prefix(strict_parser->consumed());
+    EXPECT_EQ(strict_parser->parse_batch(data, batch), ParseStatus::fail);
+    EXPECT_EQ(batch.size(), 1u);
+}
+
+// ============================================================
+// KERNELS
+// ============================================================
+
+// The inputs of the tests above, fed in the same chunks, give the same status, fields and
+// consumed count with every structural-scanning kernel as with the scalar loop
+class StrictParserKernelTest : public ::testing::TestWithParam<Config::Kernel> {
+protected:
+    struct Case {
+        Config config;
+        std::vector<std::string> chunks;
+    };
+
+    static std::vector<Case> cases() {
+        const Config strict{.parse_mode = Config::ParseMode::strict};
+        const Config crlf{.parse_mode = Config::ParseMode::strict, .line_ending = Config::LineEnding::crlf};
+        const Config cr{.parse_mode = Config::ParseMode::strict, .line_ending = Config::LineEnding::cr};
+        const Config semi{.delimiter = ';'};
+        const Config tab{.delimiter = '\t'};
+        const std::string long_field(10000, 'a');
+
+        return {
+            {strict, {"hello\n"}},
+            {strict, {"a,b,c\n"}},
+            {strict, {"a,,c\n"}},
+            {strict, {",,\n"}},
+            {strict, {"\n"}},
+            {strict, {R"(aa"ada","normal")"}},
+            {strict, {R"("something""different"here,next)"}},
+            {strict, {"\"something\"\"different\",next\n"}},
+            {strict, {"\"hello\"\n"}},
+            {strict, {"\"hello,world\"\n"}},
+            {strict, {"\"hello\nworld\"\n"}},
+            {strict, {"\"hello\"\"world\"\n"}},
+            {strict, {"\"\"\"\"\n"}},
+            {strict, {"\"\"\"\"\"\"\n"}},
+            {strict, {"\"\"\n"}},
+            {strict, {"a,\"b,c\",d\n"}},
+            {strict, {"\"a\",b,c\n"}},
+            {strict, {"a,b,\"c\"\n"}},
+            {strict, {"\"Mark\",is,quite,\"\"normal\"\"\n"}},
+            {strict, {"\"Mark\",is,quite,\"\"\"\"normal\"\"\"\"\n"}},
+            {strict, {"hello", " world\n"}},
+            {strict, {"\"hel", "lo\"\n"}},
+            {strict, {"\"hello\"", "\n"}},
+            {strict, {"\"something\"", "\"different\"", ",next\n"}},
+            {strict, {"\"something", "\n,\",different,\"", ",next\"\n"}},
+            {strict, {"\"a\"", "\"b\"\n"}},
+            {strict, {""}},
+            {strict, {"a,", "b,", "c\n"}},
+            {strict, {"a", ",", "b", "\n"}},
+            {tab, {"a\tb\tc\n"}},
+            {semi, {"a;b;c\n"}},
+            {semi, {"a,b;c,d\n"}},
+            {strict, {"hel\"lo\n"}},
+            {strict, {"\"hello\"world\n"}},
+            {strict, {"\"hello"}},
+            {strict, {"hello\",world\n"}},
+            {strict, {" \"hello\"\n"}},
+            {strict, {"\"hello\" \n"}},
+            {strict, {"a,b\nabc"}},
+            {strict, {","}},
+            {strict, {",\n"}},
+            {strict, {",,,,\n"}},
+            {strict, {"\"\",\"\"\n"}},
+            {strict, {long_field + "\n"}},
+            {strict, {"\"" + long_field + "\"\n"}},
+            {crlf, {"a,b\r\n"}},
+            {crlf, {"a,b\n"}},
+            {crlf, {"\r\n"}},
+            {crlf, {"\n"}},
+            {crlf, {"a,b\r\nc,d\r\n"}},
+            {crlf, {"a,b\r", "\n"}},
+            {crlf, {"\"a\rb\"\r\n"}},
+            {crlf, {"\"a\",b\r\n"}},
+            {cr, {"a,b\rc,d\r"}},
+            {cr, {"a,b\n"}},
+            {strict, {"a,b\r"}},
+            {strict, {"a,x\"b\"\n"}},
+            {strict, {"a,b\nc,d\n"}},
+            {strict, {"ab"}},
+            {strict, {"\",\"\n"}},
+            {strict, {"\"\n\"\n"}},
+        };
+    }
+};
+
+TEST_P(StrictParserKernelTest, MatchesScalarParser) {
+    for (const auto& [config, chunks] : cases()) {
+        Config kernel_config = config;
+        kernel_config.kernel = GetParam();
+        Config scalar_config = config;
+        scalar_config.kernel = Config::Kernel::scalar;
+
+        auto parser = make_parser(kernel_config);
+        auto expected = make_parser(scalar_config);
+        for (const auto& chunk : chunks) {
+            SCOPED_TRACE(chunk.substr(0, 40));
+            EXPECT_EQ(parser->parse(chunk), expected->parse(chunk));
+            EXPECT_EQ(parser->consumed(), expected->consumed());
+            EXPECT_EQ(parser->fields(), expected->fields());
+        }
+    }
+}
+
+TEST_P(StrictParserKernelTest, BatchMatchesScalarParser) {
+    for (std::string_view data : {"a,\"b\n\"\nc\nd,\"e", "a\nb\nc\n", "a\n\"b\"c\n"}) {
+        SCOPED_TRACE(data);
+        auto parser = make_parser({.parse_mode = Config::ParseMode::strict, .kernel = GetParam()});
+        auto expected = make_parser({.parse_mode = Config::ParseMode::strict, .kernel = Config::Kernel::scalar});
+
+        RecordBatch batch(2);
+        RecordBatch expected_batch(2);
+        while (!data.empty()) {
+            batch.clear();
+            expected_batch.clear();
+            const auto status = expected->parse_batch(data, expected_batch);
+            ASSERT_EQ(parser->parse_batch(data, batch), status);
+            ASSERT_EQ(parser->consumed(), expected->consumed());
+            ASSERT_EQ(batch.size(), expected_batch.size());
+            for (size_t i = 0; i < batch.size(); i++) {
+                EXPECT_EQ(batch[i].fields(), expected_batch[i].fields());
+            }
+            if (status != ParseStatus::complete) {
+                break;
+            }
+            data.remove_prefix(expected->consumed());
+        }
+    }
+}
+
+INSTANTIATE_TEST_SUITE_P(Kernels, StrictParserKernelTest,
+    ::testing::Values(Config::Kernel::swar, Config::Kernel::sse42, Config::Kernel::avx2, Config::Kernel::avx512),
+    [](const ::testing::TestParamInfo<Config::Kernel>& info) {
+        return std::string(simd::kernel_name(info.param));
+    });
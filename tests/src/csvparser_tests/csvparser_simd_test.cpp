@@ -0,0 +1,283 @@
+#include <gtest/gtest.h>
+
+#include <csvparser/csvparser.hpp>
+#include <csvconfig.hpp>
+#include <testdata.hpp>
+
+#include <cstdlib>
+
+using namespace csv;
+
+// every test runs once per vector kernel, kernels missing on this CPU are skipped
+class SimdParserTest : public ::testing::TestWithParam<Config::Kernel> {
+protected:
+    void SetUp() override {
+        if (!simd::supported(GetParam())) {
+            GTEST_SKIP() << simd::kernel_name(GetParam()) << " is not available on this CPU";
+        }
+    }
+
+    // feeds the same chunks to SimpleParser and SimdParser and expects identical results
+    void ExpectSameAsSimple(const std::vector<std::string>& chunks, Config cfg = {.has_quoting = false}) {
+        SimpleParser simple(cfg);
+        SimdParser simd(cfg, GetParam());
+
+        for (const auto& chunk : chunks) {
+            EXPECT_EQ(simd.parse(chunk), simple.parse(chunk)) << "chunk: " << chunk;
+            EXPECT_EQ(simd.consumed(), simple.consumed()) << "chunk: " << chunk;
+            EXPECT_EQ(simd.fields(), simple.fields()) << "chunk: " << chunk;
+        }
+    }
+};
+
+TEST_P(SimdParserTest, MakeParserSelectsSimdParsers) {
+    auto simple = make_parser({.has_quoting = false, .kernel = GetParam()});
+    EXPECT_NE(dynamic_cast<SimdParser*>(simple.get()), nullptr);
+
+    auto strict = make_parser({.parse_mode = Config::ParseMode::strict, .kernel = GetParam()});
+    EXPECT_NE(dynamic_cast<SimdStrictQuotingParser*>(strict.get()), nullptr);
+
+    auto view = make_view_parser({.has_quoting = false, .kernel = GetParam()});
+    EXPECT_NE(dynamic_cast<ViewSimdParser*>(view.get()), nullptr);
+}
+
+TEST_P(SimdParserTest, ScanMatchesScalarScan) {
+    std::string block;
+    for (int i = 0; block.size() < simd::BLOCK_SIZE; i++) {
+        block += static_cast<char>(i * 37);
+        block += "ab,\"c\"\nd";
+    }
+    block.resize(simd::BLOCK_SIZE);
+
+    auto expected = simd::scan_scalar(block.data(), ',', '\n', '"');
+    auto actual = simd::kernel_ops(GetParam()).scan(block.data(), ',', '\n', '"');
+
+    EXPECT_EQ(actual.delimiter, expected.delimiter);
+    EXPECT_EQ(actual.newline, expected.newline);
+    EXPECT_EQ(actual.quote, expected.quote);
+}
+
+TEST_P(SimdParserTest, FindStructuralMatchesSwar) {
+    std::string data(150, 'x');
+    data[17] = ',';
+    data[40] = '"';
+    data[149] = '\n';
+
+    auto find = simd::kernel_ops(GetParam()).find;
+    for (size_t begin = 0; begin < data.size(); begin += 7) {
+        for (size_t end = begin; end <= data.size(); end += 13) {
+            EXPECT_EQ(find(data.data() + begin, data.data() + end, ',', '\n', '"'),
+                      simd::find_structural_swar(data.data() + begin, data.data() + end, ',', '\n', '"'))
+                << "range: " << begin << ".." << end;
+        }
+    }
+}
+
+TEST_P(SimdParserTest, Basic_Fields) {
+    ExpectSameAsSimple({"a,,c\n"});
+    ExpectSameAsSimple({",,\n"});
+    ExpectSameAsSimple({"\n"});
+    ExpectSameAsSimple({"\"hel\"lo\",x\n"});
+}
+
+TEST_P(SimdParserTest, LongRecord_FieldsCrossBlockBoundaries) {
+    std::string record;
+    for (int i = 0; i < 40; i++) {
+        record += "field" + std::to_string(i) + ",";
+    }
+    record += "last\nnext,record\n";
+
+    ExpectSameAsSimple({record});
+}
+
+TEST_P(SimdParserTest, DelimiterAndNewlineOnBlockEdges) {
+    ExpectSameAsSimple({std::string(63, 'a') + ",b\n"});
+    ExpectSameAsSimple({std::string(64, 'a') + ",b\n"});
+    ExpectSameAsSimple({std::string(63, 'a') + "\n"});
+    ExpectSameAsSimple({std::string(128, 'a') + "\n"});
+}
+
+TEST_P(SimdParserTest, PartialRecords) {
+    ExpectSameAsSimple({"a,", "b,", "c\n"});
+    ExpectSameAsSimple({"hello", " world\n"});
+    ExpectSameAsSimple({"", "a\n"});
+    ExpectSameAsSimple({std::string(100, 'x'), std::string(100, 'y') + ",z\n"});
+}
+
+TEST_P(SimdParserTest, LineEndings) {
+    ExpectSameAsSimple({"a,b\r\n"}, {.has_quoting = false, .line_ending = Config::LineEnding::crlf});
+    ExpectSameAsSimple({"\r\n"}, {.has_quoting = false, .line_ending = Config::LineEnding::crlf});
+    ExpectSameAsSimple({"a,b\r", "\n"}, {.has_quoting = false, .line_ending = Config::LineEnding::crlf});
+    ExpectSameAsSimple({"a,b\rc,d\r"}, {.has_quoting = false, .line_ending = Config::LineEnding::cr});
+    ExpectSameAsSimple({"a,b\n"}, {.has_quoting = false, .line_ending = Config::LineEnding::cr});
+}
+
+TEST_P(SimdParserTest, CustomDelimiter) {
+    ExpectSameAsSimple({"a\tb,c\td\n"}, {.delimiter = '\t', .has_quoting = false});
+}
+
+INSTANTIATE_TEST_SUITE_P(Kernels, SimdParserTest,
+    ::testing::Values(Config::Kernel::sse42, Config::Kernel::avx2, Config::Kernel::avx512),
+    [](const ::testing::TestParamInfo<Config::Kernel>& info) {
+        return std::string(simd::kernel_name(info.param));
+    });
+
+// ============================================================
+// RUNTIME DISPATCH
+// ============================================================
+
+class KernelDispatchTest : public ::testing::Test {
+protected:
+    void TearDown() override {
+        unsetenv(simd::KERNEL_ENV_VAR);
+    }
+};
+
+TEST_F(KernelDispatchTest, AutomaticPicksBestSupportedKernel) {
+    unsetenv(simd::KERNEL_ENV_VAR);
+    EXPECT_EQ(simd::resolve_kernel(Config::Kernel::automatic), simd::best_kernel());
+    EXPECT_TRUE(simd::supported(simd::best_kernel()));
+}
+
+TEST_F(KernelDispatchTest, ScalarAndSwarAreAlwaysAvailable) {
+    EXPECT_EQ(simd::resolve_kernel(Config::Kernel::scalar), Config::Kernel::scalar);
+    EXPECT_EQ(simd::resolve_kernel(Config::Kernel::swar), Config::Kernel::swar);
+}
+
+TEST_F(KernelDispatchTest, UnsupportedKernelDegradesToSupportedOne) {
+    for (auto kernel : {Config::Kernel::sse42, Config::Kernel::avx2, Config::Kernel::avx512}) {
+        auto resolved = simd::resolve_kernel(kernel);
+        EXPECT_TRUE(simd::supported(resolved));
+        EXPECT_LE(static_cast<int>(resolved), static_cast<int>(kernel));
+    }
+}
+
+TEST_F(KernelDispatchTest, EnvironmentVariableOverridesAutomatic) {
+    setenv(simd::KERNEL_ENV_VAR, "swar", 1);
+
+    EXPECT_EQ(simd::resolve_kernel(Config::Kernel::automatic), Config::Kernel::swar);
+    auto parser = make_parser({.has_quoting = false});
+    EXPECT_NE(dynamic_cast<SwarParser*>(parser.get()), nullptr);
+}
+
+TEST_F(KernelDispatchTest, ConfigOverridesEnvironmentVariable) {
+    setenv(simd::KERNEL_ENV_VAR, "swar", 1);
+
+    auto parser = make_parser({.has_quoting = false, .kernel = Config::Kernel::scalar});
+    EXPECT_EQ(dynamic_cast<SwarParser*>(parser.get()), nullptr);
+    EXPECT_EQ(dynamic_cast<SimdParser*>(parser.get()), nullptr);
+}
+
+TEST_F(KernelDispatchTest, InvalidEnvironmentVariableIsIgnored) {
+    setenv(simd::KERNEL_ENV_VAR, "neon", 1);
+    EXPECT_EQ(simd::resolve_kernel(Config::Kernel::automatic), simd::best_kernel());
+}
+
+TEST_F(KernelDispatchTest, KernelNamesRoundTrip) {
+    for (auto kernel : {Config::Kernel::automatic, Config::Kernel::scalar, Config::Kernel::swar,
+                        Config::Kernel::sse42, Config::Kernel::avx2, Config::Kernel::avx512}) {
+        EXPECT_EQ(simd::parse_kernel(simd::kernel_name(kernel)), kernel);
+    }
+    EXPECT_EQ(simd::parse_kernel("unknown"), std::nullopt);
+}
+
+// ============================================================
+// QUOTE-REGION MASKS (strict parser)
+// ============================================================
+
+class SimdStrictParserTest : public SimdParserTest {
+protected:
+    struct Step {
+        ParseStatus status;
+        size_t consumed;
+        std::vector<std::string> fields;
+        bool operator==(const Step&) const = default;
+    };
+
+    // drives a parser the way Reader does: chunks of chunk_size bytes, reset after every record
+    static std::vector<Step> run(Parser<std::string>& parser, std::string_view data, size_t chunk_size) {
+        std::vector<Step> steps;
+        size_t offset = 0;
+        while (offset < data.size()) {
+            auto status = parser.parse(data.substr(offset, std::min(chunk_size, data.size() - offset)));
+            offset += parser.consumed();
+            steps.push_back({status, parser.consumed(), parser.fields()});
+
+            if (status == ParseStatus::fail) break;
+            if (status == ParseStatus::complete) parser.reset();
+        }
+        return steps;
+    }
+
+    void ExpectSameAsScalar(std::string_view data, Config cfg = {.parse_mode = Config::ParseMode::strict}) {
+        for (size_t chunk_size : {1u, 7u, 64u, 100u, 4096u}) {
+            StrictQuotingParser scalar(cfg);
+            SimdStrictQuotingParser simd(cfg, GetParam());
+            EXPECT_EQ(run(simd, data, chunk_size), run(scalar, data, chunk_size))
+                << "chunk size: " << chunk_size << " data: " << data;
+        }
+    }
+};
+
+TEST_P(SimdStrictParserTest, PrefixXorMarksQuotedRegions) {
+    auto prefix_xor = simd::kernel_ops(GetParam()).prefix_xor;
+    EXPECT_EQ(prefix_xor(0b1001), 0b0111u);
+    EXPECT_EQ(prefix_xor(0b0110'0001), ~uint64_t{0} ^ 0b0010'0000u);
+    EXPECT_EQ(prefix_xor(1), ~uint64_t{0});
+    EXPECT_EQ(prefix_xor(uint64_t{1} << 63), uint64_t{1} << 63);
+
+    for (uint64_t mask : {0x0123456789ABCDEFULL, 0xF0F0F0F000000001ULL, 0x8000000000000001ULL}) {
+        EXPECT_EQ(prefix_xor(mask), simd::prefix_xor_shift(mask));
+    }
+}
+
+TEST_P(SimdStrictParserTest, QuotedFieldsWithEscapes) {
+    ExpectSameAsScalar("\"a,b\",\"c\"\"d\",\"\"\"\",\"\",e\n");
+    ExpectSameAsScalar(quoted_csv_data);
+}
+
+TEST_P(SimdStrictParserTest, QuotedRegionsSpanBlocks) {
+    std::string record = "\"" + std::string(70, 'x') + ",\n\"\"" + std::string(70, 'y') + "\",plain," +
+                         "\"" + std::string(130, 'z') + "\"\nnext,\"r\"\n";
+    ExpectSameAsScalar(record);
+}
+
+TEST_P(SimdStrictParserTest, MalformedQuoting) {
+    ExpectSameAsScalar("ab\"c,d\n");
+    ExpectSameAsScalar("\"ab\"c,d\n");
+    ExpectSameAsScalar("\"ab\"\"c\n");
+    ExpectSameAsScalar("\"ab\" ,c\n");
+}
+
+TEST_P(SimdStrictParserTest, LineEndings) {
+    ExpectSameAsScalar("a,\"b\"\r\n\"c\r\n\",d\r\n", {.parse_mode = Config::ParseMode::strict, .line_ending = Config::LineEnding::crlf});
+    ExpectSameAsScalar("a,b\nc\r\n", {.parse_mode = Config::ParseMode::strict, .line_ending = Config::LineEnding::crlf});
+    ExpectSameAsScalar("\"a\"\n", {.parse_mode = Config::ParseMode::strict, .line_ending = Config::LineEnding::crlf});
+    ExpectSameAsScalar("a,\"b\rc\"\rd\r", {.parse_mode = Config::ParseMode::strict, .line_ending = Config::LineEnding::cr});
+}
+
+TEST_P(SimdStrictParserTest, RandomInputMatchesScalar) {
+    const std::string alphabet = "ab,\"\n\r";
+    uint32_t seed = 12345;
+    const auto next_random = [&seed]() {
+        seed = seed * 1103515245u + 12345u;
+        return (seed >> 16) & 0x7FFF;
+    };
+
+    for (auto line_ending : {Config::LineEnding::lf, Config::LineEnding::crlf, Config::LineEnding::cr}) {
+        for (int round = 0; round < 200; round++) {
+            std::string data;
+            const size_t length = next_random() % 300;
+            for (size_t i = 0; i < length; i++) {
+                data += alphabet[next_random() % alphabet.size()];
+            }
+            ExpectSameAsScalar(data, {.parse_mode = Config::ParseMode::strict, .line_ending = line_ending});
+        }
+    }
+}
+
+INSTANTIATE_TEST_SUITE_P(Kernels, SimdStrictParserTest,
+    ::testing::Values(Config::Kernel::sse42, Config::Kernel::avx2, Config::Kernel::avx512),
+    [](const ::testing::TestParamInfo<Config::Kernel>& info) {
+        return std::string(simd::kernel_name(info.param));
+    });
@@ -0,0 +1,118 @@
+#include <gtest/gtest.h>
+
+#include <csvparser/csvparser.hpp>
+#include <csvconfig.hpp>
+#include <testdata.hpp>
+
+using namespace csv;
+
+class SwarParserTest : public ::testing::Test {
+protected:
+    // feeds the same chunks to both parsers and expects identical results
+    template <typename Expected, typename Actual>
+    void ExpectSameParsing(Expected& expected, Actual& actual, const std::vector<std::string>& chunks) {
+        for (const auto& chunk : chunks) {
+            EXPECT_EQ(actual.parse(chunk), expected.parse(chunk)) << "chunk: " << chunk;
+            EXPECT_EQ(actual.consumed(), expected.consumed()) << "chunk: " << chunk;
+            EXPECT_EQ(actual.fields(), expected.fields()) << "chunk: " << chunk;
+        }
+    }
+
+    void ExpectSameAsSimple(const std::vector<std::string>& chunks, Config cfg = {.has_quoting = false}) {
+        SimpleParser simple(cfg);
+        SwarParser swar(cfg);
+        ExpectSameParsing(simple, swar, chunks);
+    }
+};
+
+TEST_F(SwarParserTest, MakeParserSelectsSwarParsers) {
+    auto simple = make_parser({.has_quoting = false, .kernel = Config::Kernel::swar});
+    EXPECT_NE(dynamic_cast<SwarParser*>(simple.get()), nullptr);
+
+    auto strict = make_parser({.parse_mode = Config::ParseMode::strict, .kernel = Config::Kernel::swar});
+    EXPECT_NE(dynamic_cast<SwarStrictQuotingParser*>(strict.get()), nullptr);
+
+    auto view = make_view_parser({.has_quoting = false, .kernel = Config::Kernel::swar});
+    EXPECT_NE(dynamic_cast<ViewSwarParser*>(view.get()), nullptr);
+}
+
+TEST_F(SwarParserTest, ScanMatchesScalarScan) {
+    std::string block;
+    for (int i = 0; block.size() < simd::BLOCK_SIZE; i++) {
+        block += static_cast<char>(i * 37);
+        block += ",\n\"";
+    }
+
+    auto expected = simd::scan_scalar(block.data(), ',', '\n', '"');
+    auto actual = simd::scan_swar(block.data(), ',', '\n', '"');
+
+    EXPECT_EQ(actual.delimiter, expected.delimiter);
+    EXPECT_EQ(actual.newline, expected.newline);
+    EXPECT_EQ(actual.quote, expected.quote);
+}
+
+TEST_F(SwarParserTest, ScanHasNoFalsePositivesNextToMatches) {
+    // bytes that differ from the delimiter by one bit used to trip the classic has-zero-byte trick
+    std::string block(simd::BLOCK_SIZE, '-');
+    block[0] = ',';
+    block[1] = ',' ^ 1;
+    block[2] = ',' ^ static_cast<char>(0x80);
+
+    auto masks = simd::scan_swar(block.data(), ',', '\n', '"');
+    EXPECT_EQ(masks.delimiter, 1u);
+}
+
+TEST_F(SwarParserTest, FindStructural) {
+    std::string data = "abcdefghijklmnop\"rest";
+    const char* end = data.data() + data.size();
+
+    EXPECT_EQ(simd::find_structural_swar(data.data(), end, ',', '\n', '"'), data.data() + 16);
+    EXPECT_EQ(simd::find_structural_swar(data.data(), data.data() + 16, ',', '\n', '"'), data.data() + 16);
+    EXPECT_EQ(simd::find_structural_swar(data.data() + 3, data.data() + 5, ',', '\n', '"'), data.data() + 5);
+    EXPECT_EQ(simd::find_structural_swar(end, end, ',', '\n', '"'), end);
+}
+
+TEST_F(SwarParserTest, Simple_Basic) {
+    ExpectSameAsSimple({"a,,c\n"});
+    ExpectSameAsSimple({"\n"});
+    ExpectSameAsSimple({"\"hel\"lo\",x\n"});
+    ExpectSameAsSimple({std::string(63, 'a') + ",b\n"});
+    ExpectSameAsSimple({std::string(200, 'a') + "," + std::string(200, 'b') + "\n"});
+}
+
+TEST_F(SwarParserTest, Simple_PartialRecords) {
+    ExpectSameAsSimple({"a,", "b,", "c\n"});
+    ExpectSameAsSimple({std::string(100, 'x'), std::string(100, 'y') + ",z\n"});
+}
+
+TEST_F(SwarParserTest, Simple_LineEndings) {
+    ExpectSameAsSimple({"a,b\r", "\n"}, {.has_quoting = false, .line_ending = Config::LineEnding::crlf});
+    ExpectSameAsSimple({"a,b\rc,d\r"}, {.has_quoting = false, .line_ending = Config::LineEnding::cr});
+}
+
+TEST_F(SwarParserTest, ViewParser_SameFieldsAsViewSimpleParser) {
+    Config cfg{.has_quoting = false};
+    ViewSimpleParser simple(cfg);
+    ViewSwarParser swar(cfg);
+
+    std::string record = "first,second," + std::string(70, 'x') + ",last\n";
+    ExpectSameParsing(simple, swar, {record});
+}
+
+TEST_F(SwarParserTest, Strict_LongQuotedRecords) {
+    Config cfg{.parse_mode = Config::ParseMode::strict};
+    StrictQuotingParser strict(cfg);
+    SwarStrictQuotingParser swar(cfg);
+
+    std::string record = "\"" + std::string(40, 'q') + ",\n" + std::string(40, 'r') + "\"\"x\"," +
+                         std::string(50, 'u') + ",\"\"\n";
+    ExpectSameParsing(strict, swar, {record});
+}
+
+TEST_F(SwarParserTest, Strict_QuotedDataAcrossChunks) {
+    Config cfg{.parse_mode = Config::ParseMode::strict};
+    StrictQuotingParser strict(cfg);
+    SwarStrictQuotingParser swar(cfg);
+
+    ExpectSameParsing(strict, swar, {"\"abcdefghij\"", "\"klmnopqrstuvwxyz\",", "plain text value\n"});
+}
@@ -0,0 +1,122 @@
+#include <gtest/gtest.h>
+
+#include <csvparser/csvparser.hpp>
+#include <csvconfig.hpp>
+
+using namespace csv;
+
+class ViewQuotingParserTest : public ::testing::Test {
+protected:
+    bool points_into(std::string_view field, std::string_view buffer) {
+        return field.data() >= buffer.data() && field.data() + field.size() <= buffer.data() + buffer.size();
+    }
+};
+
+TEST_F(ViewQuotingParserTest, MakeViewParserSelectsQuotingParser) {
+    auto quoting = make_view_parser({});
+    EXPECT_NE(dynamic_cast<ViewQuotingParser*>(quoting.get()), nullptr);
+
+    auto simple = make_view_parser({.has_quoting = false});
+    EXPECT_EQ(dynamic_cast<ViewQuotingParser*>(simple.get()), nullptr);
+}
+
+TEST_F(ViewQuotingParserTest, QuotedFieldsWithoutEscapesAreViewsIntoBuffer) {
+    ViewQuotingParser parser({});
+    const std::string buffer = "plain,\"a,b\",\"multi\nline\"\nnext\n";
+
+    ASSERT_EQ(parser.parse(buffer), ParseStatus::complete);
+    EXPECT_EQ(parser.fields(), (std::vector<std::string_view>{"plain", "a,b", "multi\nline"}));
+    EXPECT_EQ(parser.consumed(), 25u);
+
+    for (auto field : parser.fields()) {
+        EXPECT_TRUE(points_into(field, buffer)) << field;
+    }
+}
+
+TEST_F(ViewQuotingParserTest, OnlyEscapedFieldsAreCopied) {
+    ViewQuotingParser parser({});
+    const std::string buffer = "\"say \"\"hi\"\"\",\"x\"\n";
+
+    ASSERT_EQ(parser.parse(buffer), ParseStatus::complete);
+    EXPECT_EQ(parser.fields(), (std::vector<std::string_view>{"say \"hi\"", "x"}));
+    EXPECT_FALSE(points_into(parser.fields()[0], buffer));
+    EXPECT_TRUE(points_into(parser.fields()[1], buffer));
+}
+
+TEST_F(ViewQuotingParserTest, IncompleteRecordConsumesNothing) {
+    ViewQuotingParser parser({});
+
+    EXPECT_EQ(parser.parse("a,\"b\nc"), ParseStatus::need_more_data);
+    EXPECT_EQ(parser.consumed(), 0u);
+
+    EXPECT_EQ(parser.parse("a,\"b\nc\"\n"), ParseStatus::complete);
+    EXPECT_EQ(parser.fields(), (std::vector<std::string_view>{"a", "b\nc"}));
+}
+
+TEST_F(ViewQuotingParserTest, ShiftViewsMovesBufferFieldsOnly) {
+    ViewQuotingParser parser({});
+    std::string old_buffer = "ab,\"c\"\"d\",e";
+    std::string new_buffer = old_buffer;
+
+    ASSERT_EQ(parser.parse(old_buffer), ParseStatus::need_more_data);
+    parser.shift_views(new_buffer.data());
+    old_buffer.assign(old_buffer.size(), '#');
+
+    EXPECT_EQ(parser.fields(), (std::vector<std::string_view>{"ab", "c\"d", "e"}));
+}
+
+TEST_F(ViewQuotingParserTest, StrictRejectsMalformedQuoting) {
+    ViewQuotingParser parser({});
+    EXPECT_EQ(parser.parse("a,\"b\"c\n"), ParseStatus::fail);
+}
+
+TEST_F(ViewQuotingParserTest, LenientKeepsMalformedQuoting) {
+    ViewQuotingParser parser({.parse_mode = Config::ParseMode::lenient});
+    ASSERT_EQ(parser.parse("a,\"b\"c,d\n"), ParseStatus::complete);
+    EXPECT_EQ(parser.fields(), (std::vector<std::string_view>{"a", "bc", "d"}));
+}
+
+TEST_F(ViewQuotingParserTest, LenientQuotedFieldsAreViewsIntoBuffer) {
+    ViewQuotingParser parser({.parse_mode = Config::ParseMode::lenient});
+    const std::string buffer = "plain,\"a,b\",\"multi\nline\"\nnext\n";
+
+    ASSERT_EQ(parser.parse(buffer), ParseStatus::complete);
+    EXPECT_EQ(parser.fields(), (std::vector<std::string_view>{"plain", "a,b", "multi\nline"}));
+    EXPECT_EQ(parser.consumed(), 25u);
+
+    for (auto field : parser.fields()) {
+        EXPECT_TRUE(points_into(field, buffer)) << field;
+    }
+}
+
+TEST_F(ViewQuotingParserTest, LenientStrayQuoteDoesNotShiftLaterRecords) {
+    ViewQuotingParser parser({.parse_mode = Config::ParseMode::lenient});
+    const std::string buffer = "5\" pipe,x\n\"a,b\",c\n\"d\"\n";
+    std::string_view rest = buffer;
+
+    ASSERT_EQ(parser.parse(rest), ParseStatus::complete);
+    EXPECT_EQ(parser.fields(), (std::vector<std::string_view>{"5\" pipe", "x"}));
+    rest.remove_prefix(parser.consumed());
+
+    ASSERT_EQ(parser.parse(rest), ParseStatus::complete);
+    EXPECT_EQ(parser.fields(), (std::vector<std::string_view>{"a,b", "c"}));
+    EXPECT_TRUE(points_into(parser.fields()[0], buffer));
+    rest.remove_prefix(parser.consumed());
+
+    ASSERT_EQ(parser.parse(rest), ParseStatus::complete);
+    EXPECT_EQ(parser.fields(), (std::vector<std::string_view>{"d"}));
+    EXPECT_EQ(parser.consumed(), rest.size());
+}
+
+TEST_F(ViewQuotingParserTest, CrlfRecords) {
+    ViewQuotingParser parser({.line_ending = Config::LineEnding::crlf});
+    ASSERT_EQ(parser.parse("\"a\r\nb\",c\r\n"), ParseStatus::complete);
+    EXPECT_EQ(parser.fields(), (std::vector<std::string_view>{"a\r\nb", "c"}));
+}
+
+TEST_F(ViewQuotingParserTest, EmptyLineHasNoFields) {
+    ViewQuotingParser parser({});
+    ASSERT_EQ(parser.parse("\na\n"), ParseStatus::complete);
+    EXPECT_TRUE(parser.fields().empty());
+    EXPECT_EQ(parser.consumed(), 1u);
+}
@@ -0,0 +1,157 @@
+#include <gtest/gtest.h>
+
+#include <csvparser/csvparser.hpp>
+#include <csvparser/csvstructuralindex.hpp>
+#include <csvconfig.hpp>
+
+using namespace csv;
+
+class StructuralIndexTest : public ::testing::TestWithParam<Config::Kernel> {
+protected:
+    void SetUp() override {
+        if (!simd::supported(GetParam())) {
+            GTEST_SKIP() << simd::kernel_name(GetParam()) << " is not supported on this CPU";
+        }
+    }
+
+    StructuralIndex make_index(const Config& config, bool quote_aware = true) {
+        return StructuralIndex(config, simd::kernel_ops(GetParam()), quote_aware);
+    }
+
+    // parses every record of data from consecutive views of one buffer, as Reader does
+    template <typename ParserType>
+    std::vector<std::vector<std::string>> parse_all(ParserType& parser, std::string_view data) {
+        std::vector<std::vector<std::string>> records;
+        while (!data.empty()) {
+            parser.reset();
+            if (parser.parse(data) != ParseStatus::complete) break;
+            records.emplace_back(parser.fields().begin(), parser.fields().end());
+            data.remove_prefix(parser.consumed());
+        }
+        return records;
+    }
+};
+
+TEST_P(StructuralIndexTest, IndexesFieldAndRecordEnds) {
+    auto index = make_index({});
+    const std::string data = "a,bb,ccc\nd,e,f\n";
+    index.build(data);
+
+    ASSERT_EQ(index.record_count(), 2);
+    EXPECT_EQ(index.offsets(), (std::vector<uint32_t>{1, 4, 8, 10, 12, 14}));
+    EXPECT_EQ(index.indexed_bytes(), data.size());
+
+    EXPECT_EQ(index.field_count(0), 3);
+    EXPECT_EQ(index.raw_field(0, 1), "bb");
+    EXPECT_EQ(index.raw_field(1, 2), "f");
+    EXPECT_EQ(index.record_begin(1), 9);
+    EXPECT_EQ(index.record_end(1), 15);
+}
+
+TEST_P(StructuralIndexTest, IgnoresStructuralCharactersInsideQuotes) {
+    auto index = make_index({});
+    const std::string data = "\"a,\nb\",\"x\"\"y\"\nplain,\"q\"\n";
+    index.build(data);
+
+    ASSERT_EQ(index.record_count(), 2);
+    EXPECT_EQ(index.raw_field(0, 0), "\"a,\nb\"");
+    EXPECT_EQ(index.raw_field(0, 1), "\"x\"\"y\"");
+    EXPECT_TRUE(index.field_has_quotes(0, 0));
+    EXPECT_FALSE(index.field_has_quotes(1, 0));
+    EXPECT_TRUE(index.field_has_quotes(1, 1));
+}
+
+TEST_P(StructuralIndexTest, QuotesAreDataWhenNotQuoteAware) {
+    auto index = make_index({.has_quoting = false}, false);
+    index.build("\"a,b\"\n");
+
+    ASSERT_EQ(index.record_count(), 1);
+    EXPECT_EQ(index.field_count(0), 2);
+}
+
+TEST_P(StructuralIndexTest, DropsIncompleteLastRecord) {
+    auto index = make_index({});
+    index.build("a,b\nc,\"d\ne");
+
+    EXPECT_EQ(index.record_count(), 1);
+    EXPECT_EQ(index.indexed_bytes(), 4);
+    EXPECT_EQ(index.offsets().size(), 2);
+}
+
+TEST_P(StructuralIndexTest, CountsProjectsAndSkipsRecords) {
+    auto index = make_index({});
+    std::string data;
+    for (int i = 0; i < 500; i++) {
+        data += std::to_string(i) + ",\"name " + std::to_string(i) + "\",x\n";
+    }
+    index.build(data);
+
+    ASSERT_EQ(index.record_count(), 500);
+    EXPECT_EQ(index.raw_field(321, 0), "321");
+    EXPECT_EQ(index.raw_field(321, 1), "\"name 321\"");
+
+    // skipping is a byte offset lookup
+    std::string_view rest = std::string_view(data).substr(index.record_begin(499));
+    EXPECT_EQ(rest, "499,\"name 499\",x\n");
+}
+
+TEST_P(StructuralIndexTest, FindRecordContinuesTheWindow) {
+    auto index = make_index({});
+    const std::string data = "a\nb\nc";
+    std::string_view buffer = data;
+
+    EXPECT_EQ(index.find_record(buffer), 0);
+    buffer.remove_prefix(index.record_end(0));
+    EXPECT_EQ(index.find_record(buffer), 1);
+    buffer.remove_prefix(index.record_end(1) - index.record_begin(1));
+
+    // "c" has no newline, so a rebuild finds nothing
+    EXPECT_EQ(index.find_record(buffer), std::string_view::npos);
+}
+
+TEST_P(StructuralIndexTest, StrictParserMatchesScalarAcrossConsecutiveViews) {
+    Config config{.parse_mode = Config::ParseMode::strict};
+    std::string data;
+    for (int i = 0; i < 300; i++) {
+        data += std::to_string(i) + ",\"q\"\"" + std::to_string(i) + "\",\"multi\nline\",plain\n";
+    }
+
+    StrictQuotingParser scalar(config);
+    SimdStrictQuotingParser indexed(config, GetParam());
+
+    auto expected = parse_all(scalar, data);
+    ASSERT_EQ(expected.size(), 300);
+    EXPECT_EQ(parse_all(indexed, data), expected);
+}
+
+TEST_P(StructuralIndexTest, StrictParserFallsBackOnMalformedRecord) {
+    Config config{.parse_mode = Config::ParseMode::strict};
+    const std::string data = "a,b\nc,\"d\"x\ne,f\n";
+
+    StrictQuotingParser scalar(config);
+    SimdStrictQuotingParser indexed(config, GetParam());
+
+    EXPECT_EQ(parse_all(indexed, data), parse_all(scalar, data));
+}
+
+TEST_P(StructuralIndexTest, SimpleParserMatchesScalarAcrossConsecutiveViews) {
+    Config config{.has_quoting = false, .line_ending = Config::LineEnding::crlf};
+    std::string data;
+    for (int i = 0; i < 300; i++) {
+        data += std::to_string(i) + ",\"x\"," + std::string(static_cast<size_t>(i % 70), 'y') + "\r\n";
+    }
+
+    SimpleParser scalar(config);
+    SimdParser indexed(config, GetParam());
+
+    auto expected = parse_all(scalar, data);
+    ASSERT_EQ(expected.size(), 300);
+    EXPECT_EQ(parse_all(indexed, data), expected);
+}
+
+INSTANTIATE_TEST_SUITE_P(
+    Kernels,
+    StructuralIndexTest,
+    ::testing::Values(Config::Kernel::swar, Config::Kernel::sse42, Config::Kernel::avx2, Config::Kernel::avx512),
+    [](const auto& info) { return std::string(simd::kernel_name(info.param)); }
+);
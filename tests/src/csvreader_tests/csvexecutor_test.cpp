@@ -0,0 +1,101 @@
+#include <gtest/gtest.h>
+#include <csvexecutor.hpp>
+#include <atomic>
+#include <chrono>
+#include <mutex>
+#include <set>
+#include <stdexcept>
+#include <thread>
+
+using namespace csv;
+
+TEST(ExecutorTest, RunsEveryTask) {
+    WorkStealingExecutor executor(4);
+    EXPECT_EQ(executor.concurrency(), 4u);
+
+    std::atomic<int> sum{0};
+    TaskGroup tasks(executor);
+    for (int i = 1; i <= 1000; i++) {
+        tasks.run([&sum, i] { sum += i; });
+    }
+    tasks.wait();
+
+    EXPECT_EQ(sum, 1000 * 1001 / 2);
+}
+
+TEST(ExecutorTest, IdleWorkersStealQueuedTasks) {
+    WorkStealingExecutor executor(4);
+    std::mutex mutex;
+    std::set<std::thread::id> threads;
+
+    TaskGroup outer(executor);
+    outer.run([&] {
+        // submitted from a worker, so all of them start in its own deque
+        TaskGroup inner(executor);
+        for (int i = 0; i < 40; i++) {
+            inner.run([&] {
+                std::this_thread::sleep_for(std::chrono::milliseconds(1));
+                std::lock_guard lock(mutex);
+                threads.insert(std::this_thread::get_id());
+            });
+        }
+        inner.wait();
+    });
+    outer.wait();
+
+    EXPECT_GT(threads.size(), 1u);
+}
+
+TEST(ExecutorTest, NestedWaitOnSingleWorkerHelps) {
+    WorkStealingExecutor executor(1);
+    std::atomic<int> done{0};
+
+    TaskGroup outer(executor);
+    outer.run([&] {
+        // the only worker waits here, it runs the inner tasks itself
+        TaskGroup inner(executor);
+        for (int i = 0; i < 10; i++) {
+            inner.run([&] { done++; });
+        }
+        inner.wait();
+        done++;
+    });
+    outer.wait();
+
+    EXPECT_EQ(done, 11);
+}
+
+TEST(ExecutorTest, TaskGroupRethrowsFirstException) {
+    WorkStealingExecutor executor(2);
+    std::atomic<int> ran{0};
+
+    TaskGroup tasks(executor);
+    for (int i = 0; i < 10; i++) {
+        tasks.run([&ran, i] {
+            ran++;
+            if (i == 3) {
+                throw std::runtime_error("task failed");
+            }
+        });
+    }
+
+    EXPECT_THROW(tasks.wait(), std::runtime_error);
+    EXPECT_EQ(ran, 10);
+    EXPECT_NO_THROW(tasks.wait());
+}
+
+TEST(ExecutorTest, DestructorRunsQueuedTasks) {
+    std::atomic<int> ran{0};
+    {
+        WorkStealingExecutor executor(1);
+        for (int i = 0; i < 100; i++) {
+            executor.submit([&ran] { ran++; });
+        }
+    }
+    EXPECT_EQ(ran, 100);
+}
+
+TEST(ExecutorTest, DefaultExecutorIsShared) {
+    EXPECT_EQ(&default_executor(), &default_executor());
+    EXPECT_GE(default_executor().concurrency(), 1u);
+}
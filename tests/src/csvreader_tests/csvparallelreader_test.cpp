@@ -0,0 +1,316 @@
+#include <gtest/gtest.h>
+#include <csvreader/csvparallelreader.hpp>
+#include <csvrecord/csvrecordbatch.hpp>
+#include <csverrors.hpp>
+#include <csvexecutor.hpp>
+#include <atomic>
+#include <cstdio>
+#include <fstream>
+#include <mutex>
+#include <string>
+#include <thread>
+
+using namespace csv;
+
+class ParallelReaderTest : public ::testing::Test {
+protected:
+    const std::string filename_ = "test_parallel_reader.tmp";
+
+    void TearDown() override {
+        std::remove(filename_.c_str());
+    }
+
+    void write_file(const std::string& content) {
+        std::ofstream out(filename_, std::ios::binary);
+        out << content;
+    }
+
+    std::string make_content(size_t rows) {
+        std::string content = "id,name,value\n";
+        for (size_t i = 0; i < rows; i++) {
+            content += std::to_string(i) + ",name" + std::to_string(i % 13) + "," + std::to_string(i * 7) + "\n";
+        }
+        return content;
+    }
+
+    void expect_same_records(ParallelReader& reader, ViewReader& expected) {
+        EXPECT_EQ(reader.headers(), expected.headers());
+        while (expected.next()) {
+            ASSERT_TRUE(reader.next());
+            EXPECT_EQ(reader.current_record().fields(), expected.current_record().fields());
+            EXPECT_EQ(reader.line_number(), expected.line_number());
+        }
+        EXPECT_FALSE(reader.next());
+    }
+};
+
+TEST_F(ParallelReaderTest, MatchesViewReaderAcrossChunks) {
+    write_file(make_content(20000));
+    ParallelReader reader(filename_, {}, 4, 1000);
+    ViewReader expected(filename_);
+
+    EXPECT_GT(reader.chunk_count(), 100u);
+    EXPECT_EQ(reader.threads(), 4u);
+    expect_same_records(reader, expected);
+}
+
+TEST_F(ParallelReaderTest, SingleThread) {
+    write_file(make_content(5000));
+    ParallelReader reader(filename_, {}, 1, 512);
+    ViewReader expected(filename_);
+
+    EXPECT_EQ(reader.threads(), 1u);
+    expect_same_records(reader, expected);
+}
+
+TEST_F(ParallelReaderTest, NoTrailingNewline) {
+    write_file("a,b\n1,2\n3,4");
+    ParallelReader reader(filename_, {}, 2, 2);
+
+    ASSERT_TRUE(reader.next());
+    EXPECT_EQ(reader.current_record()[0], "1");
+    ASSERT_TRUE(reader.next());
+    EXPECT_EQ(reader.current_record()[1], "4");
+    EXPECT_FALSE(reader.next());
+}
+
+TEST_F(ParallelReaderTest, WithoutHeader) {
+    write_file("1,2\n3,4\n");
+    ParallelReader reader(filename_, {.has_header = false}, 2, 1);
+
+    EXPECT_TRUE(reader.headers().empty());
+    ASSERT_TRUE(reader.next());
+    EXPECT_EQ(reader.current_record()[0], "1");
+    EXPECT_EQ(reader.line_number(), 1u);
+    ASSERT_TRUE(reader.next());
+    EXPECT_EQ(reader.current_record()[0], "3");
+    EXPECT_EQ(reader.line_number(), 2u);
+    EXPECT_FALSE(reader.next());
+}
+
+TEST_F(ParallelReaderTest, HeaderOnly) {
+    write_file("a,b,c\n");
+    ParallelReader reader(filename_);
+
+    EXPECT_EQ(reader.headers(), std::vector<std::string>({"a", "b", "c"}));
+    EXPECT_EQ(reader.chunk_count(), 0u);
+    EXPECT_FALSE(reader.next());
+}
+
+TEST_F(ParallelReaderTest, RecordSizePolicyAppliesInFileOrder) {
+    std::string content = make_content(3000);
+    content += "1,2\n";
+    write_file(content + make_content(10).substr(14));
+
+    ParallelReader reader(filename_, {}, 3, 256);
+    for (size_t i = 0; i < 3000; i++) {
+        ASSERT_TRUE(reader.next());
+    }
+    EXPECT_THROW((void)reader.next(), RecordSizeError);
+}
+
+TEST_F(ParallelReaderTest, QuotedLineBreaksAtAnyChunkSize) {
+    std::string content = "id,text,note\n";
+    for (size_t i = 0; i < 300; i++) {
+        content += std::to_string(i) + ",\"line one\nline \"\"two\"\", more\n\",plain\n";
+        content += std::to_string(i) + ",\"\",\"a,b\"\n";
+    }
+    write_file(content);
+
+    for (size_t chunk_size : {1, 2, 7, 16, 64, 100, 333, 4096}) {
+        ParallelReader reader(filename_, {}, 3, chunk_size);
+        ViewReader expected(filename_);
+        expect_same_records(reader, expected);
+    }
+}
+
+TEST_F(ParallelReaderTest, QuotedFieldLongerThanChunks) {
+    const std::string long_field(5000, 'x');
+    write_file("a,b\n1,\"" + long_field + "\n" + long_field + "\"\n2,\"\n\"\n3,x\n");
+    ParallelReader reader(filename_, {}, 4, 100);
+
+    ASSERT_TRUE(reader.next());
+    EXPECT_EQ(reader.current_record()[1], long_field + "\n" + long_field);
+    ASSERT_TRUE(reader.next());
+    EXPECT_EQ(reader.current_record()[1], "\n");
+    ASSERT_TRUE(reader.next());
+    EXPECT_EQ(reader.current_record()[0], "3");
+    EXPECT_FALSE(reader.next());
+}
+
+TEST_F(ParallelReaderTest, ChunksResumeAfterLongRecord) {
+    std::string content = "a,b\n1,\"" + std::string(300, 'x') + "\"\n";
+    for (size_t i = 0; i < 2000; i++) {
+        content += std::to_string(i % 10) + ",y\n";
+    }
+    write_file(content);
+    ParallelReader reader(filename_, {}, 4, 64);
+
+    // one chunk for the long record, the short rows are split at every raw boundary again
+    EXPECT_GT(reader.chunk_count(), content.size() / 64 - 10);
+    ViewReader expected(filename_);
+    expect_same_records(reader, expected);
+}
+
+TEST_F(ParallelReaderTest, QuotesAreDataWithoutQuoting) {
+    write_file("a,b\n\"1,2\n3,4\"\n5,6\n");
+    Config cfg{.has_quoting = false};
+    ParallelReader reader(filename_, cfg, 2, 3);
+    ViewReader expected(filename_, cfg);
+    expect_same_records(reader, expected);
+}
+
+TEST_F(ParallelReaderTest, StopsAtStrictParseErrorAcrossChunks) {
+    auto content = make_content(300);
+    const size_t bad = content.find("\n150,") + 1;
+    content.insert(bad, "150,\"bad\"x,0\n");
+    write_file(content);
+
+    // chunk sizes that put the bad record at, before and across a chunk boundary
+    for (size_t chunk_size : {1, 7, 16, 64, 100, 333, 4096}) {
+        ParallelReader reader(filename_, {}, 3, chunk_size);
+        ViewReader expected(filename_);
+        expect_same_records(reader, expected);
+        EXPECT_LT(reader.line_number(), 152u);
+    }
+}
+
+TEST_F(ParallelReaderTest, LenientQuotedInputIsOneChunk) {
+    write_file("a,b\n1,x\"y\n2,\"z\n3,4\n");
+    Config cfg{.parse_mode = Config::ParseMode::lenient};
+    ParallelReader reader(filename_, cfg, 2, 3);
+    ViewReader expected(filename_, cfg);
+
+    EXPECT_EQ(reader.chunk_count(), 1u);
+    expect_same_records(reader, expected);
+}
+
+TEST_F(ParallelReaderTest, NextBatchReadsAllRecords) {
+    write_file(make_content(10000));
+    ParallelReader reader(filename_, {}, 2, 4096);
+    ViewReader expected(filename_);
+
+    // a few records through next(), the rest of that batch comes with next_batch()
+    for (size_t i = 0; i < 5; i++) {
+        ASSERT_TRUE(reader.next());
+        ASSERT_TRUE(expected.next());
+    }
+
+    RecordBatch batch;
+    size_t records = 5;
+    while (reader.next_batch(batch)) {
+        for (size_t i = 0; i < batch.size(); i++) {
+            ASSERT_TRUE(expected.next());
+            EXPECT_EQ(batch[i].fields(), expected.current_record().fields());
+        }
+        records += batch.size();
+        EXPECT_EQ(reader.line_number(), records);
+    }
+    EXPECT_EQ(records, 10000u);
+    EXPECT_FALSE(expected.next());
+}
+
+TEST_F(ParallelReaderTest, CompressedFileThrows) {
+    write_file(std::string("\x1f\x8b\x08\x00", 4));
+    EXPECT_THROW(ParallelReader{filename_}, ConfigError);
+}
+
+TEST_F(ParallelReaderTest, MissingFileThrows) {
+    EXPECT_THROW(ParallelReader{"does_not_exist.csv"}, std::runtime_error);
+}
+
+namespace {
+
+// an application's executor without threads of its own: tasks run when they are submitted
+class InlineExecutor : public Executor {
+public:
+    void submit(std::function<void()> task) override {
+        submitted++;
+        task();
+    }
+
+    size_t concurrency() const noexcept override {
+        return 1;
+    }
+
+    std::atomic<size_t> submitted{0};
+};
+
+}
+
+TEST_F(ParallelReaderTest, RunsOnGivenExecutor) {
+    write_file(make_content(5000));
+    InlineExecutor executor;
+    ParallelReader reader(filename_, {}, 0, 1000, executor);
+    ViewReader expected(filename_);
+
+    EXPECT_EQ(reader.threads(), 1u);
+    expect_same_records(reader, expected);
+    EXPECT_EQ(executor.submitted, reader.chunk_count() + 1);
+}
+
+TEST_F(ParallelReaderTest, SharesExecutorBetweenReaders) {
+    write_file(make_content(5000));
+    WorkStealingExecutor executor(2);
+    ParallelReader first(filename_, {}, 2, 1000, executor);
+    ParallelReader second(filename_, {}, 2, 1000, executor);
+
+    size_t records = 0;
+    while (first.next()) {
+        ASSERT_TRUE(second.next());
+        EXPECT_EQ(first.current_record().fields(), second.current_record().fields());
+        records++;
+    }
+    EXPECT_FALSE(second.next());
+    EXPECT_EQ(records, 5000u);
+}
+
+TEST_F(ParallelReaderTest, WaitingCallerRunsOnlyItsOwnTasks) {
+    write_file(make_content(20000));
+    WorkStealingExecutor executor(1);
+    const auto caller = std::this_thread::get_id();
+    std::mutex user_mutex;
+
+    // the only worker is busy, so the tasks of both readers stay queued
+    std::atomic<bool> release{false};
+    TaskGroup blocker(executor);
+    blocker.run([&] {
+        while (!release) {
+            std::this_thread::yield();
+        }
+    });
+
+    std::unique_lock user_lock(user_mutex);
+    ParallelReader reader(filename_, {}, 2, 4096, executor);
+
+    // a second reader on the same executor, its callback takes the lock this thread holds
+    std::atomic<bool> other_waits{false};
+    std::atomic<bool> other_ran_here{false};
+    std::thread other([&] {
+        ViewReader other_reader(filename_);
+        other_reader.parallel_for_each([&](const RecordBatch::RecordRef&) {
+            if (std::this_thread::get_id() == caller) {
+                // locking here would deadlock
+                other_ran_here = true;
+                return;
+            }
+            other_waits = true;
+            std::lock_guard lock(user_mutex);
+        }, 2, executor);
+    });
+    while (!other_waits) {
+        std::this_thread::yield();
+    }
+
+    size_t records = 0;
+    while (reader.next()) {
+        records++;
+    }
+    EXPECT_EQ(records, 20000u);
+    EXPECT_FALSE(other_ran_here);
+
+    user_lock.unlock();
+    release = true;
+    other.join();
+    blocker.wait();
+}
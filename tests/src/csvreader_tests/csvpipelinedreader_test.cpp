@@ -0,0 +1,170 @@
+#include <gtest/gtest.h>
+#include <csvreader/csvpipelinedreader.hpp>
+#include <csvbuffer/csvmemorybuffer.hpp>
+#include <csvbuffer/csvpipebuffer.hpp>
+#include <csvrecord/csvrecordbatch.hpp>
+#include <csverrors.hpp>
+#include <testdata.hpp>
+#include <cstdio>
+#include <fstream>
+#include <sstream>
+#include <string>
+#include <thread>
+
+#include <fcntl.h>
+#include <unistd.h>
+
+using namespace csv;
+
+class PipelinedReaderTest : public ::testing::Test {
+protected:
+    const std::string filename_ = "test_pipelined_reader.tmp";
+
+    void TearDown() override {
+        std::remove(filename_.c_str());
+    }
+
+    std::string make_content(size_t rows) {
+        std::string content = "id,name,value\n";
+        for (size_t i = 0; i < rows; i++) {
+            content += std::to_string(i) + ",\"name\n" + std::to_string(i % 13) + "\"," + std::to_string(i * 7) + "\n";
+        }
+        return content;
+    }
+
+    template <typename ReaderType>
+    void expect_same_records(PipelinedReader& reader, ReaderType& expected) {
+        EXPECT_EQ(reader.headers(), expected.headers());
+        while (expected.next()) {
+            ASSERT_TRUE(reader.next());
+            const auto& fields = reader.current_record().fields();
+            EXPECT_EQ(std::vector<std::string>(fields.begin(), fields.end()),
+                      std::vector<std::string>(expected.current_record().fields().begin(), expected.current_record().fields().end()));
+            EXPECT_EQ(reader.line_number(), expected.line_number());
+        }
+        EXPECT_FALSE(reader.next());
+        EXPECT_FALSE(reader.good());
+    }
+};
+
+TEST_F(PipelinedReaderTest, MatchesReaderOnFile) {
+    const auto content = make_content(20000);
+    std::ofstream(filename_, std::ios::binary) << content;
+
+    PipelinedReader reader(filename_);
+    Reader expected(filename_);
+    expect_same_records(reader, expected);
+}
+
+TEST_F(PipelinedReaderTest, MatchesReaderOnStream) {
+    const auto content = make_content(5000);
+    PipelinedReader reader(std::make_unique<std::istringstream>(content), {}, 1);
+    Reader expected(std::make_unique<std::istringstream>(content));
+    expect_same_records(reader, expected);
+}
+
+TEST_F(PipelinedReaderTest, ReadsPipe) {
+    int fds[2];
+    ASSERT_EQ(pipe2(fds, O_CLOEXEC), 0);
+    std::thread writer([&] {
+        size_t written = 0;
+        while (written < quoted_csv_data.size()) {
+            ssize_t bytes = write(fds[1], quoted_csv_data.data() + written, quoted_csv_data.size() - written);
+            if (bytes <= 0) break;
+            written += static_cast<size_t>(bytes);
+        }
+        close(fds[1]);
+    });
+
+    {
+        PipelinedReader reader(make_pipe_buffer(fds[0]));
+        Reader expected(std::make_unique<std::istringstream>(quoted_csv_data));
+        expect_same_records(reader, expected);
+    }
+    writer.join();
+    close(fds[0]);
+}
+
+TEST_F(PipelinedReaderTest, ReadsPipeWhileWriterIsOpen) {
+    int fds[2];
+    ASSERT_EQ(pipe2(fds, O_CLOEXEC), 0);
+    const std::string rows = "a,b\n1,2\n3,4\n";
+    ASSERT_EQ(write(fds[1], rows.data(), rows.size()), static_cast<ssize_t>(rows.size()));
+
+    {
+        // records that arrived are returned without waiting for more input,
+        // and the destructor does not wait for the writer either
+        PipelinedReader reader(make_pipe_buffer(fds[0]));
+        EXPECT_EQ(reader.headers(), std::vector<std::string>({"a", "b"}));
+        ASSERT_TRUE(reader.next());
+        EXPECT_EQ(reader.current_record()[0], "1");
+        ASSERT_TRUE(reader.next());
+        EXPECT_EQ(reader.current_record()[1], "4");
+    }
+
+    close(fds[0]);
+    close(fds[1]);
+}
+
+TEST_F(PipelinedReaderTest, NoTrailingNewline) {
+    PipelinedReader reader(make_memory_buffer("a,b\n1,2\n3,4"));
+
+    ASSERT_TRUE(reader.next());
+    EXPECT_EQ(reader.current_record()[0], "1");
+    ASSERT_TRUE(reader.next());
+    EXPECT_EQ(reader.current_record()[1], "4");
+    EXPECT_FALSE(reader.next());
+}
+
+TEST_F(PipelinedReaderTest, HeaderOnly) {
+    PipelinedReader reader(make_memory_buffer("a,b,c\n"));
+    EXPECT_EQ(reader.headers(), std::vector<std::string>({"a", "b", "c"}));
+    EXPECT_FALSE(reader.next());
+}
+
+TEST_F(PipelinedReaderTest, RecordSizePolicyAppliesInOrder) {
+    PipelinedReader reader(make_memory_buffer("a,b\n1,2\n3\n"));
+    ASSERT_TRUE(reader.next());
+    EXPECT_THROW((void)reader.next(), RecordSizeError);
+}
+
+TEST_F(PipelinedReaderTest, ParseErrorReachesCaller) {
+    // a record that does not fit in the parse window
+    Config cfg{.has_header = false};
+    std::string content = "1,2\n" + std::string(200000, 'x') + "\n";
+    PipelinedReader reader(std::make_unique<std::istringstream>(content), cfg);
+
+    ASSERT_TRUE(reader.next());
+    EXPECT_THROW((void)reader.next(), RecordTooLargeError);
+}
+
+TEST_F(PipelinedReaderTest, NextBatchRecyclesBatches) {
+    const auto content = make_content(10000);
+    PipelinedReader reader(std::make_unique<std::istringstream>(content), {}, 2);
+    Reader expected(std::make_unique<std::istringstream>(content));
+
+    for (size_t i = 0; i < 3; i++) {
+        ASSERT_TRUE(reader.next());
+        ASSERT_TRUE(expected.next());
+    }
+
+    RecordBatch batch;
+    size_t records = 3;
+    while (reader.next_batch(batch)) {
+        for (size_t i = 0; i < batch.size(); i++) {
+            ASSERT_TRUE(expected.next());
+            const auto fields = batch[i].fields();
+            EXPECT_EQ(std::vector<std::string>(fields.begin(), fields.end()), expected.current_record().fields());
+        }
+        records += batch.size();
+        EXPECT_EQ(reader.line_number(), records);
+    }
+    EXPECT_EQ(records, 10000u);
+}
+
+TEST_F(PipelinedReaderTest, StopsEarly) {
+    // the parse thread is blocked on a full queue when the reader is destroyed
+    const auto content = make_content(100000);
+    PipelinedReader reader(std::make_unique<std::istringstream>(content), {}, 1);
+    ASSERT_TRUE(reader.next());
+}
@@ -1,7 +1,12 @@
 #include <gtest/gtest.h>
 #include <csvreader/csvreader.hpp>
+#include <csvreader/csvdialectreader.hpp>
+#include <csvreader/csvbasicreader.hpp>
 #include <csverrors.hpp>
 #include <testdata.hpp>
+#include <atomic>
+#include <thread>
+#include <csvexecutor.hpp>
 
 #include <csvbuffer_mock.hpp>
 
@@ -222,4 +227,249 @@ TEST_F(ReaderTest, ConfigError_RecordSizePolicy_StrictToValue_ValueZero) {
     };
 
     EXPECT_THROW(Reader reader("./test_data/simple_file.csv", cfg), csv::ConfigError);
-}
\ No newline at end of file
+}
+
+TEST_F(ReaderTest, ConfigError_FileBufferKindOverStream) {
+    for (auto kind : {Config::BufferKind::mapped, Config::BufferKind::uring, Config::BufferKind::fd,
+                      Config::BufferKind::direct_io}) {
+        EXPECT_THROW(Reader(std::make_unique<std::istringstream>("a\n"), {.buffer_kind = kind}), csv::ConfigError);
+    }
+    EXPECT_NO_THROW(Reader(std::make_unique<std::istringstream>("a\n"), {.buffer_kind = Config::BufferKind::ring}));
+}
+// --- Compile-time dialect
+
+TEST_F(ReaderTest, DialectReader_ReadsSameRecordsAsReader) {
+    DialectReader<Rfc4180Dialect> dialect_reader{std::make_unique<std::istringstream>(quoted_csv_data)};
+
+    EXPECT_EQ(dialect_reader.headers(), quoted_data_reader.headers());
+    while (quoted_data_reader.next()) {
+        ASSERT_TRUE(dialect_reader.next());
+        EXPECT_EQ(dialect_reader.current_record().fields(), quoted_data_reader.current_record().fields());
+    }
+    EXPECT_FALSE(dialect_reader.next());
+}
+
+TEST_F(ReaderTest, DialectReader_OverridesDialectOptionsOfConfig) {
+    DialectReader<Dialect<';'>> reader{std::make_unique<std::istringstream>("a;b\n\"1;2\";3\n"), {.delimiter = ','}};
+
+    EXPECT_EQ(reader.config().delimiter, ';');
+    EXPECT_EQ(reader.headers(), (std::vector<std::string>{"a", "b"}));
+    ASSERT_TRUE(reader.next());
+    EXPECT_EQ(reader.current_record().fields(), (std::vector<std::string>{"1;2", "3"}));
+}
+
+// --- Batches
+
+TEST_F(ReaderTest, NextBatch_ReadsSameRecordsAsNext) {
+    Reader batch_reader{std::make_unique<std::istringstream>(quoted_csv_data)};
+    RecordBatch batch(2);
+
+    EXPECT_EQ(batch_reader.headers(), quoted_data_reader.headers());
+    while (batch_reader.next_batch(batch)) {
+        for (size_t i = 0; i < batch.size(); i++) {
+            ASSERT_TRUE(quoted_data_reader.next());
+            const auto fields = batch[i].fields();
+            EXPECT_EQ(std::vector<std::string>(fields.begin(), fields.end()), quoted_data_reader.current_record().fields());
+        }
+        EXPECT_EQ(batch_reader.line_number(), quoted_data_reader.line_number());
+    }
+    EXPECT_FALSE(quoted_data_reader.next());
+}
+
+TEST_F(ReaderTest, NextBatch_FillsAcrossRefillsUpToCapacity) {
+    std::string data;
+    for (int i = 0; i < 5000; i++) {
+        data += std::to_string(i) + ",x\n";
+    }
+    data += "last,y";
+    Reader reader{std::make_unique<std::istringstream>(data), {.has_header = false}};
+
+    RecordBatch batch(4096);
+    ASSERT_TRUE(reader.next_batch(batch));
+    EXPECT_EQ(batch.size(), 4096u);
+    EXPECT_EQ(batch[4095][0], "4095");
+
+    ASSERT_TRUE(reader.next_batch(batch));
+    ASSERT_EQ(batch.size(), 905u);
+    EXPECT_EQ(batch[904].fields(), (std::vector<std::string_view>{"last", "y"}));
+    EXPECT_EQ(reader.line_number(), 5001u);
+
+    EXPECT_FALSE(reader.next_batch(batch));
+    EXPECT_TRUE(batch.empty());
+}
+
+TEST_F(ReaderTest, NextBatch_AppliesRecordSizePolicy) {
+    Reader reader{std::make_unique<std::istringstream>("a,b\n1,2\n3\n"), {.record_size_policy = Config::RecordSizePolicy::strict_to_header}};
+    RecordBatch batch;
+    EXPECT_THROW((void)reader.next_batch(batch), RecordSizeError);
+}
+
+namespace {
+
+std::string numbered_csv(size_t rows) {
+    std::string content = "id,value\n";
+    for (size_t i = 1; i <= rows; i++) {
+        content += std::to_string(i) + ",\"v" + std::to_string(i) + "\"\n";
+    }
+    return content;
+}
+
+}
+
+TEST_F(ReaderTest, ParallelForEach_VisitsEveryRecord) {
+    Reader reader{std::make_unique<std::istringstream>(numbered_csv(10000))};
+    std::atomic<size_t> sum{0};
+    std::atomic<size_t> count{0};
+
+    reader.parallel_for_each([&](const RecordBatch::RecordRef& record) {
+        sum += std::stoul(std::string(record[0]));
+        count++;
+        EXPECT_EQ(record[1], "v" + std::string(record[0]));
+    }, 4);
+
+    EXPECT_EQ(count, 10000u);
+    EXPECT_EQ(sum, 10000u * 10001u / 2);
+    EXPECT_EQ(reader.line_number(), 10000u);
+}
+
+TEST_F(ReaderTest, ParallelReduce_SumsRecords) {
+    Reader reader{std::make_unique<std::istringstream>(numbered_csv(5000))};
+    const auto sum = reader.parallel_reduce(size_t{7},
+        [](const RecordBatch::RecordRef& record) { return std::stoul(std::string(record[0])); },
+        [](size_t a, size_t b) { return a + b; }, 3);
+
+    EXPECT_EQ(sum, 7 + 5000u * 5001u / 2);
+}
+
+TEST_F(ReaderTest, ParallelReduce_NoRecordsGivesInit) {
+    Reader reader{std::make_unique<std::istringstream>("a,b\n")};
+    const auto result = reader.parallel_reduce(std::string("init"),
+        [](const RecordBatch::RecordRef& record) { return std::string(record[0]); },
+        [](std::string a, std::string b) { return a + b; });
+
+    EXPECT_EQ(result, "init");
+}
+
+TEST_F(ReaderTest, ParallelForEach_RethrowsCallbackException) {
+    Reader reader{std::make_unique<std::istringstream>(numbered_csv(20000))};
+    std::atomic<size_t> count{0};
+
+    EXPECT_THROW(reader.parallel_for_each([&](const RecordBatch::RecordRef& record) {
+        count++;
+        if (record[0] == "1500") {
+            throw std::runtime_error("bad record");
+        }
+    }, 2), std::runtime_error);
+    EXPECT_LT(count, 20000u);
+}
+
+TEST_F(ReaderTest, ParallelForEach_RethrowsReaderException) {
+    Reader reader{std::make_unique<std::istringstream>(numbered_csv(3000) + "1\n")};
+    EXPECT_THROW(reader.parallel_for_each([](const RecordBatch::RecordRef&) {}, 2), RecordSizeError);
+}
+
+TEST_F(ReaderTest, ParallelForEach_RunsOnGivenExecutor) {
+    Reader reader{std::make_unique<std::istringstream>(numbered_csv(3000))};
+    WorkStealingExecutor executor(3);
+    std::atomic<size_t> count{0};
+
+    reader.parallel_for_each([&](const RecordBatch::RecordRef&) { count++; }, 0, executor);
+    EXPECT_EQ(count, 3000u);
+}
+
+TEST_F(ReaderTest, ParallelForEach_LimitsConcurrentCallsToThreads) {
+    Reader reader{std::make_unique<std::istringstream>(numbered_csv(20000))};
+    WorkStealingExecutor executor(4);
+    std::atomic<size_t> active{0};
+    std::atomic<size_t> max_active{0};
+
+    reader.parallel_for_each([&](const RecordBatch::RecordRef&) {
+        const size_t now = ++active;
+        size_t seen = max_active;
+        while (now > seen && !max_active.compare_exchange_weak(seen, now)) {}
+        std::this_thread::yield();
+        active--;
+    }, 2, executor);
+
+    EXPECT_LE(max_active, 2u);
+}
+
+TEST_F(ReaderTest, ParallelForEach_SingleThreadRunsOnCaller) {
+    // counts the tasks it is given
+    struct CountingExecutor : Executor {
+        void submit(std::function<void()> task) override {
+            submitted++;
+            task();
+        }
+        size_t concurrency() const noexcept override {
+            return 4;
+        }
+        size_t submitted = 0;
+    };
+
+    Reader reader{std::make_unique<std::istringstream>(numbered_csv(5000))};
+    CountingExecutor executor;
+    const auto caller = std::this_thread::get_id();
+    size_t count = 0;
+
+    reader.parallel_for_each([&](const RecordBatch::RecordRef&) {
+        EXPECT_EQ(std::this_thread::get_id(), caller);
+        count++;
+    }, 1, executor);
+
+    EXPECT_EQ(count, 5000u);
+    EXPECT_EQ(executor.submitted, 0u);
+}
+
+// --- Statically bound buffer and parser
+
+TEST_F(ReaderTest, BasicReader_ReadsSameRecordsAsReader) {
+    BasicReader<StreamBuffer<64>, StrictQuotingParser> basic_reader{std::make_unique<std::istringstream>(quoted_csv_data)};
+
+    EXPECT_EQ(basic_reader.headers(), quoted_data_reader.headers());
+    while (quoted_data_reader.next()) {
+        ASSERT_TRUE(basic_reader.next());
+        EXPECT_EQ(basic_reader.current_record().fields(), quoted_data_reader.current_record().fields());
+        EXPECT_EQ(basic_reader.line_number(), quoted_data_reader.line_number());
+    }
+    EXPECT_FALSE(basic_reader.next());
+}
+
+TEST_F(ReaderTest, BasicReader_ViewParserGivesRecordViews) {
+    using ViewBasicReader = BasicReader<StreamBuffer<8>, ViewQuotingParser>;
+    static_assert(std::is_same_v<ViewBasicReader::record_type, RecordView>);
+
+    ViewBasicReader reader{std::make_unique<std::istringstream>("a,b\n\"x,y\",z\n1,\"2\"\"\""), {.has_header = false}};
+    // views are valid until the next read, so the fields are copied
+    std::vector<std::vector<std::string>> records;
+    for (const auto& record : reader) {
+        records.emplace_back(record.fields().begin(), record.fields().end());
+    }
+
+    EXPECT_EQ(records, (std::vector<std::vector<std::string>>{{"a", "b"}, {"x,y", "z"}, {"1", "2\""}}));
+}
+
+TEST_F(ReaderTest, BasicReader_NextBatch) {
+    BasicReader<StreamBuffer<16>, DialectParser<Rfc4180Dialect>> reader{std::make_unique<std::istringstream>("h\n1\n2\n3\n4\n5")};
+    RecordBatch batch(3);
+
+    ASSERT_TRUE(reader.next_batch(batch));
+    EXPECT_EQ(batch.size(), 3u);
+    ASSERT_TRUE(reader.next_batch(batch));
+    ASSERT_EQ(batch.size(), 2u);
+    EXPECT_EQ(batch[1][0], "5");
+    EXPECT_FALSE(reader.next_batch(batch));
+    EXPECT_EQ(reader.line_number(), 5u);
+}
+
+TEST_F(ReaderTest, BasicReader_ReadsFile) {
+    BasicReader<StreamBuffer<>, SimpleParser> reader("./test_data/simple_file.csv");
+    Reader expected("./test_data/simple_file.csv");
+
+    EXPECT_EQ(reader.headers(), expected.headers());
+    while (expected.next()) {
+        ASSERT_TRUE(reader.next());
+        EXPECT_EQ(reader.current_record().fields(), expected.current_record().fields());
+    }
+    EXPECT_FALSE(reader.next());
+}
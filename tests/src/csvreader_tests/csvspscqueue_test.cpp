@@ -0,0 +1,85 @@
+#include <gtest/gtest.h>
+#include <csvreader/csvspscqueue.hpp>
+#include <string>
+#include <thread>
+
+using namespace csv;
+
+TEST(SpscQueueTest, PopsInPushOrder) {
+    SpscQueue<int> queue(4);
+    for (int i = 0; i < 4; i++) {
+        ASSERT_TRUE(queue.push(int(i)));
+    }
+    for (int i = 0; i < 4; i++) {
+        int value = -1;
+        ASSERT_TRUE(queue.pop(value));
+        EXPECT_EQ(value, i);
+    }
+}
+
+TEST(SpscQueueTest, CloseDrainsThenStops) {
+    SpscQueue<std::string> queue(2);
+    ASSERT_TRUE(queue.push("a"));
+    queue.close();
+
+    std::string value;
+    ASSERT_TRUE(queue.pop(value));
+    EXPECT_EQ(value, "a");
+    EXPECT_FALSE(queue.pop(value));
+}
+
+TEST(SpscQueueTest, CancelFailsPush) {
+    SpscQueue<int> queue(1);
+    queue.cancel();
+    EXPECT_FALSE(queue.push(1));
+}
+
+TEST(SpscQueueTest, TransfersAcrossThreadsThroughSmallQueue) {
+    constexpr int count = 100000;
+    SpscQueue<int> queue(3);
+
+    std::thread producer([&] {
+        for (int i = 0; i < count; i++) {
+            if (!queue.push(int(i))) return;
+        }
+        queue.close();
+    });
+
+    long long sum = 0;
+    int expected = 0;
+    int value;
+    while (queue.pop(value)) {
+        ASSERT_EQ(value, expected++);
+        sum += value;
+    }
+    producer.join();
+
+    EXPECT_EQ(expected, count);
+    EXPECT_EQ(sum, static_cast<long long>(count) * (count - 1) / 2);
+}
+
+TEST(SpscQueueTest, CancelWakesBlockedProducer) {
+    SpscQueue<int> queue(1);
+    ASSERT_TRUE(queue.push(0));
+
+    bool pushed = true;
+    std::thread producer([&] { pushed = queue.push(1); });
+    queue.cancel();
+    producer.join();
+
+    EXPECT_FALSE(pushed);
+}
+
+TEST(SpscQueueTest, CloseWakesBlockedConsumer) {
+    SpscQueue<int> queue(1);
+
+    bool popped = true;
+    std::thread consumer([&] {
+        int value;
+        popped = queue.pop(value);
+    });
+    queue.close();
+    consumer.join();
+
+    EXPECT_FALSE(popped);
+}
@@ -2,6 +2,10 @@
 #include <csvreader/csvreader.hpp>
 #include <csvbuffer/csvstreambuffer.hpp>
 #include <sstream>
+#include <random>
+#include <atomic>
+#include <mutex>
+#include <set>
 
 using namespace csv;
 
@@ -38,6 +42,19 @@ TEST_F(ViewReaderTest, RecordLargerThanBuffer_ThrowsException) {
     EXPECT_THROW(reader.next(), std::runtime_error);
 }
 
+TEST_F(ViewReaderTest, QuotedRecordFillingTheWindow_ThrowsRecordTooLarge) {
+    // the quoting parser consumes nothing until the record is complete, the refill reports buffer_full
+    auto reader = createReader<8>("a\n\"0123456789\",b\nc\n", {.has_header = false});
+
+    ASSERT_TRUE(reader.next());
+    EXPECT_EQ(reader.current_record()[0], "a");
+    EXPECT_THROW((void)reader.next(), RecordTooLargeError);
+
+    RecordBatch batch;
+    auto batch_reader = createReader<8>("\"0123456789\",b\n", {.has_header = false});
+    EXPECT_THROW((void)batch_reader.next_batch(batch), RecordTooLargeError);
+}
+
 TEST_F(ViewReaderTest, SplitRecord_FitsInBuffer_StitchingWorks) {
     auto reader = createReader<4>("a\nb\nc\n", {.has_header = false});
     ASSERT_TRUE(reader.next()); EXPECT_EQ(reader.current_record()[0], "a");
@@ -85,4 +102,120 @@ TEST_F(ViewReaderTest, HeadersAreSaved_NextFieldsAreCorrectlyRead) {
     ASSERT_TRUE(reader.next());
     EXPECT_EQ(reader.current_record().fields(), std::vector<std::string_view>({"56", "78"}));
     EXPECT_EQ(reader.headers(), std::vector<std::string>({"AA", "BB"}));
-}
\ No newline at end of file
+}
+// --- Quoted data
+
+TEST_F(ViewReaderTest, QuotedRecordSplitAcrossRefills) {
+    auto reader = createReader<16>("h1,h2\n\"a,\"\"b\"\"\",\"c\nd\"\n", {});
+
+    EXPECT_EQ(reader.headers(), std::vector<std::string>({"h1", "h2"}));
+    ASSERT_TRUE(reader.next());
+    EXPECT_EQ(reader.current_record().fields(), std::vector<std::string_view>({"a,\"b\"", "c\nd"}));
+    ASSERT_FALSE(reader.next());
+}
+
+TEST_F(ViewReaderTest, QuotedLastRecordWithoutNewline) {
+    auto reader = createReader<8>("x,\"y z\"", {.has_header = false});
+    ASSERT_TRUE(reader.next());
+    EXPECT_EQ(reader.current_record().fields(), std::vector<std::string_view>({"x", "y z"}));
+    ASSERT_FALSE(reader.next());
+}
+
+TEST_F(ViewReaderTest, QuotedDataMatchesReader) {
+    std::mt19937 rng(11);
+    const std::vector<std::string> fields = {"a", "bc", "", "\"q\"", "\"x,y\"", "\"l\nl\"", "\"e\"\"e\"", "\"\""};
+
+    std::string data;
+    for (int row = 0; row < 400; row++) {
+        for (int column = 0; column < 3; column++) {
+            if (column) data += ',';
+            data += fields[rng() % fields.size()];
+        }
+        data += '\n';
+    }
+
+    for (auto mode : {Config::ParseMode::strict, Config::ParseMode::lenient}) {
+        Config cfg{.has_header = false, .parse_mode = mode};
+        Reader expected(std::make_unique<std::istringstream>(data), cfg);
+        auto actual = createReader<32>(data, cfg);
+
+        while (expected.next()) {
+            ASSERT_TRUE(actual.next());
+            const auto& view_fields = actual.current_record().fields();
+            EXPECT_EQ(std::vector<std::string>(view_fields.begin(), view_fields.end()), expected.current_record().fields());
+        }
+        EXPECT_FALSE(actual.next());
+    }
+}
+
+// --- Batches
+
+TEST_F(ViewReaderTest, NextBatch_ReadsSameRecordsAsNext) {
+    std::mt19937 rng(5);
+    const std::vector<std::string> fields = {"a", "bc", "", "\"q\"", "\"x,y\"", "\"l\nl\"", "\"e\"\"e\""};
+
+    std::string data;
+    for (int row = 0; row < 300; row++) {
+        data += fields[rng() % fields.size()] + "," + fields[rng() % fields.size()] + "\n";
+    }
+    data += "end,\"no newline\"";
+
+    for (bool quoting : {true, false}) {
+        Config cfg{.has_header = false, .has_quoting = quoting, .record_size_policy = Config::RecordSizePolicy::flexible};
+        auto expected = createReader<64>(data, cfg);
+        auto actual = createReader<64>(data, cfg);
+        RecordBatch batch(16);
+
+        while (actual.next_batch(batch)) {
+            EXPECT_LE(batch.size(), 16u);
+            for (size_t i = 0; i < batch.size(); i++) {
+                ASSERT_TRUE(expected.next());
+                EXPECT_EQ(batch[i].fields(), expected.current_record().fields());
+            }
+            EXPECT_EQ(actual.line_number(), expected.line_number());
+        }
+        EXPECT_FALSE(expected.next());
+    }
+}
+
+TEST_F(ViewReaderTest, NextBatch_StopsOnParseFailure) {
+    auto reader = createReader<64>("a\nb\n\"c\"d\n", {.has_header = false});
+    RecordBatch batch;
+
+    ASSERT_TRUE(reader.next_batch(batch));
+    EXPECT_EQ(batch.size(), 2u);
+    EXPECT_FALSE(reader.next_batch(batch));
+}
+
+TEST_F(ViewReaderTest, ParallelForEach_BatchesOutliveTheBufferWindow) {
+    std::string data = "id,text\n";
+    for (size_t i = 0; i < 3000; i++) {
+        data += std::to_string(i) + ",\"t\"\"" + std::to_string(i) + "\"\n";
+    }
+    // a small window is refilled many times while the workers still hold earlier batches
+    auto reader = createReader<256>(data);
+    std::mutex mutex;
+    std::set<std::string> seen;
+
+    reader.parallel_for_each([&](const RecordBatch::RecordRef& record) {
+        ASSERT_EQ(record[1], "t\"" + std::string(record[0]));
+        std::lock_guard lock(mutex);
+        seen.emplace(record[0]);
+    }, 3);
+
+    EXPECT_EQ(seen.size(), 3000u);
+}
+
+TEST_F(ViewReaderTest, ParallelReduce_CountsFields) {
+    std::string data = "a,b,c\n";
+    for (size_t i = 0; i < 2000; i++) {
+        data += "1,2,3\n";
+    }
+    auto reader = createReader<1024>(data);
+
+    const auto fields = reader.parallel_reduce(size_t{0},
+        [](const RecordBatch::RecordRef& record) { return record.size(); },
+        [](size_t a, size_t b) { return a + b; }, 2);
+
+    EXPECT_EQ(fields, 6000u);
+}
@@ -0,0 +1,69 @@
+#include <gtest/gtest.h>
+#include <csvrecord/csvrecordbatch.hpp>
+
+using namespace csv;
+
+TEST(RecordBatchTest, AppendCopiesOwnedFields) {
+    RecordBatch batch(4);
+    {
+        std::vector<std::string> fields = {"a", "bc"};
+        batch.append(fields);
+        fields = {"", "d", "efg"};
+        batch.append(fields);
+    }
+
+    ASSERT_EQ(batch.size(), 2u);
+    EXPECT_EQ(batch.field_count(), 5u);
+    EXPECT_EQ(batch[0].fields(), (std::vector<std::string_view>{"a", "bc"}));
+    EXPECT_EQ(batch[1].size(), 3u);
+    EXPECT_EQ(batch[1][0], "");
+    EXPECT_EQ(batch[1][2], "efg");
+}
+
+TEST(RecordBatchTest, FieldsInSourceAreReferenced) {
+    const std::string buffer = "x,yy\n";
+    std::string outside = "zzz";
+
+    RecordBatch batch;
+    batch.set_source(buffer);
+    batch.append(std::vector<std::string_view>{std::string_view(buffer).substr(0, 1), std::string_view(buffer).substr(2, 2), outside});
+    outside = "###";
+
+    EXPECT_EQ(batch[0][0].data(), buffer.data());
+    EXPECT_EQ(batch[0][1].data(), buffer.data() + 2);
+    EXPECT_EQ(batch[0][2], "zzz");
+}
+
+TEST(RecordBatchTest, EmptyRecord) {
+    RecordBatch batch;
+    batch.append(std::vector<std::string_view>{});
+    batch.append(std::vector<std::string_view>{"a"});
+
+    ASSERT_EQ(batch.size(), 2u);
+    EXPECT_TRUE(batch[0].empty());
+    EXPECT_EQ(batch[1][0], "a");
+}
+
+TEST(RecordBatchTest, FullAndClear) {
+    RecordBatch batch(2);
+    EXPECT_TRUE(batch.empty());
+
+    batch.append(std::vector<std::string>{"a"});
+    EXPECT_FALSE(batch.full());
+    batch.append(std::vector<std::string>{"b"});
+    EXPECT_TRUE(batch.full());
+
+    batch.clear();
+    EXPECT_TRUE(batch.empty());
+    EXPECT_EQ(batch.field_count(), 0u);
+    EXPECT_EQ(batch.capacity(), 2u);
+}
+
+TEST(RecordBatchTest, AtChecksBounds) {
+    RecordBatch batch;
+    batch.append(std::vector<std::string>{"a", "b"});
+
+    EXPECT_EQ(batch.at(0).at(1), "b");
+    EXPECT_THROW(batch.at(1), std::out_of_range);
+    EXPECT_THROW(batch.at(0).at(2), std::out_of_range);
+}
@@ -0,0 +1,40 @@
+#pragma once
+
+#include <gtest/gtest.h>
+#include <fstream>
+#include <string>
+
+#include <csvbuffer/csvbuffer.hpp>
+
+// rows "<i>,field<i % 7>" until the content has at least size bytes
+inline std::string make_content(size_t size) {
+    std::string content;
+    for (size_t i = 0; content.size() < size; i++) {
+        content += std::to_string(i) + ",field" + std::to_string(i % 7) + "\n";
+    }
+    return content;
+}
+
+// reads everything the way ViewReader does: refill when empty, consume what was looked at
+inline std::string read_all(csv::IBuffer& buffer, size_t consume_step) {
+    std::string result;
+    while (true) {
+        if (buffer.empty()) {
+            auto status = buffer.refill();
+            if (status == csv::ReadingResult::eof) break;
+            if (status != csv::ReadingResult::ok) {
+                ADD_FAILURE() << "refill failed";
+                break;
+            }
+        }
+        auto view = buffer.view().substr(0, consume_step);
+        result += view;
+        buffer.consume(view.size());
+    }
+    return result;
+}
+
+inline void create_temp_file(const std::string& filename, const std::string& content) {
+    std::ofstream out(filename, std::ios::binary);
+    out << content;
+}